@@ -2,7 +2,46 @@
 #define STR_LIFETIME_PTR_HPP
 
 #include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <exception>
 #include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef OPTR_LOCK_ORDER_CHECK
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#endif
+
+#ifdef OPTR_ENABLE_CENSUS
+#include <chrono>
+#include <cxxabi.h>
+#include <cstdlib>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#endif
+
+#ifdef OPTR_ENABLE_LATENCY_HISTOGRAM
+#include <chrono>
+#include <ostream>
+#endif
+
+#ifdef OPTR_ENABLE_NUMA
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace optr
 {
@@ -19,9 +58,39 @@ namespace optr
     class owning_owner_v;
     template <typename OwnedType>
     class owning_owner_o;
+    template <typename OwnedType>
+    class owning_transfer_o;
 
     class enable_owning_share_this;
 
+    ///-------------------------------------------------------------------------------------------------------
+    ///Compile-time feature selection per held type                             ------------------------------
+    ///- specialize owning_traits<T> ( deriving owning_traits_default ) before T's first owning_ptr use
+    ///- types sharing a register through casts must agree on every register field below ( all but share_this, lock_class )
+    struct owning_traits_default
+    {
+        static constexpr bool alive_flag = true;    ///< owner-alive flag in register ( alive() )
+        static constexpr bool lockable   = true;    ///< mutex in register ( get_lock() )
+        static constexpr bool upgradeable = false;  ///< shared/upgrade mutex ( get_shared_lock(), get_upgrade_lock() )
+        static constexpr bool share_this = true;    ///< enable_owning_share_this support
+        static constexpr bool isolate_refcount = false; ///< alive flag and mutex on their own cache line
+        static constexpr bool mailbox = false;      ///< lock-free closure queue in register ( owning_ptr_o::post() )
+        static constexpr bool track_owner_thread = false;   ///< owning thread in register ( owner_thread() )
+        static constexpr const char* lock_class = nullptr;  ///< lock-order node name ( nullptr : held type )
+    };
+    template <typename OwnedType>
+    struct owning_traits
+    :
+        public owning_traits_default
+    {};
+
+    ///Latency distributions recorded with OPTR_ENABLE_LATENCY_HISTOGRAM
+    enum class owning_latency_metric : unsigned
+    {
+        lock_wait = 0,      ///< time blocked in get_lock() before the mutex was acquired
+        destroy   = 1       ///< time spent releasing register and object after the last sharer
+    };
+
     ///Make owning_owner_v declaration
     template <typename OwnedType>
     static inline __attribute__((always_inline))
@@ -56,15 +125,66 @@ namespace optr
     owning_ptr_o<PtrCastType>
         owning_ptr_cast_o(const owning_ptr_o<OwnedType>& cOPtr);
 
+    ///Make pooled owning_owner_o declaration
+    template <typename OwnedType, typename... Args>
+    static inline __attribute__((always_inline))
+    owning_owner_o<OwnedType>
+        make_pooled_owning_owner_o(Args&&... args);
+    ///Make n owning_owner_o in one slab declaration
+    template <typename OwnedType, typename... Args>
+    static inline
+    std::vector<owning_owner_o<OwnedType>>
+        make_owning_owners_o(size_t n,
+                             const Args&... args);
+
     namespace optr_implem
     {
-        ///Forward declarations
+        ///Register layout selected by owning_traits
+        template <bool AliveFlag, bool Lockable, bool Upgradeable = false, bool IsolateRefcount = false,
+                  bool Mailbox = false, bool TrackOwnerThread = false>
+        struct owning_register_layout
+        {
+            static_assert(Lockable || !Upgradeable, "owning_traits<T>::upgradeable requires lockable");
+            static_assert(AliveFlag || !TrackOwnerThread, "owning_traits<T>::track_owner_thread requires alive_flag");
+
+            static constexpr bool alive_flag  = AliveFlag;
+            static constexpr bool lockable    = Lockable;
+            static constexpr bool upgradeable = Upgradeable;
+            static constexpr bool isolate_refcount = IsolateRefcount;
+            static constexpr bool mailbox     = Mailbox;
+            static constexpr bool track_owner_thread = TrackOwnerThread;
+        };
         template <typename OwnedType>
+        using owning_layout_of = owning_register_layout<owning_traits<OwnedType>::alive_flag,
+                                                        owning_traits<OwnedType>::lockable,
+                                                        owning_traits<OwnedType>::upgradeable,
+                                                        owning_traits<OwnedType>::isolate_refcount,
+                                                        owning_traits<OwnedType>::mailbox,
+                                                        owning_traits<OwnedType>::track_owner_thread>;
+
+        constexpr size_t CACHE_LINE_ = 64;  ///< destructive interference size assumed by isolate_refcount
+
+        ///Forward declarations
+        template <typename Layout>
+        class owning_ptr_register_v;
+        template <typename Layout>
+        class owning_ptr_register_o;
+        template <typename RgstrType, typename OwnedType>
         class owning_ptr_mutex_lock;
         template <typename RgstrType, typename OwnedType>
         class owning_ptr_base;
         template <typename RgstrType, typename PtrCastType>
         class owning_ptr_base;
+        template <typename OwnedType>
+        class owning_ptr_pool;
+        class owning_ptr_access;
+        class owning_ptr_census;
+
+        ///Register types used for OwnedType
+        template <typename OwnedType>
+        using register_v_of = owning_ptr_register_v<owning_layout_of<OwnedType>>;
+        template <typename OwnedType>
+        using register_o_of = owning_ptr_register_o<owning_layout_of<OwnedType>>;
     };  // end of optr_implem namespace
 
 };  // end of optr namespace
@@ -82,8 +202,10 @@ namespace optr
         ///HOLD OWNING_PTR SHARED BASE INFORMATION                                  ------------------------------
         class owning_ptr_register
         {
+            friend class owning_ptr_census;
+
             public:
-                ///Destructor
+                ///Destructor ( census already left by owning_ptr_register_v / _o )
                 virtual ~owning_ptr_register()
                 {};
 
@@ -109,15 +231,49 @@ namespace optr
                     operator==(const size_t scount) const {
                     return this->share_count == scount;
                 };
+                ///Drop one share, returning true for the caller that dropped the last one
+                ///- decrement and zero test are one RMW: a separate --/==(0) lets two racing releasers both see 0
+                inline __attribute__((always_inline))
+                bool
+                    drop_share()
+                {
+                    const size_t prev = this->share_count.fetch_sub(1, std::memory_order_acq_rel);
+                    assert(prev != 0 && "owning_ptr share_count underflow");
+                    return prev == 1;
+                };
 
-                ATM_B_ b_alive;         ///< Indicates primary owner still 'alive'
-                MTX_ mutex_optr;        ///< Shared access mutex lock
+                ///Hand register+object block back to its allocator ( false : separately new'd, caller deletes both )
+                virtual bool
+                    release_block()
+                {
+                    return false;
+                };
+
+            #ifdef OPTR_ENABLE_CENSUS
+                ///Owner alive state as reported by census ( no virtual call, safe while derived parts are built )
+                inline
+                bool
+                    census_alive() const {
+                    return this->census_alive_flag == nullptr || this->census_alive_flag->load(std::memory_order_acquire);
+                };
+
+                ///Remove register from live census
+                inline
+                void
+                    census_leave();
+
+                const char* census_type = nullptr;                      ///< mangled held type name
+                const ATM_B_* census_alive_flag = nullptr;              ///< owner alive flag ( nullptr : always alive )
+                std::chrono::steady_clock::time_point census_birth;     ///< time entered census
+                owning_ptr_register* census_prev = nullptr;             ///< census list links
+                owning_ptr_register* census_next = nullptr;
+                bool b_census = false;                                  ///< currently in census list
+            #endif
 
             protected:
               ///Init Constructor
                 owning_ptr_register()
                 :
-                    b_alive(false),
                     share_count(0)
                 {};
 
@@ -129,268 +285,1493 @@ namespace optr
                 owning_ptr_register(owning_ptr_register&&) = delete;
         };
 
+    #ifdef OPTR_ENABLE_CENSUS
         ///-------------------------------------------------------------------------------------------------------
-        ///HOLD LIVING_PTR SHARED BASE INFORMATION                                  ------------------------------
-        class owning_ptr_register_v
-        :
-            public owning_ptr_register
+        ///INTRUSIVE LIST OF EVERY LIVE REGISTER ( OPTR_ENABLE_CENSUS )             ------------------------------
+        class owning_ptr_census
         {
-            template <typename RgstrType, typename OwnedType>
-            friend class owning_ptr_base;
-
             public:
-                ///Destructor
-                virtual ~owning_ptr_register_v()
-                {};
-
-            protected:
-                ///Default Constructor
-                owning_ptr_register_v()
-                {};
+                ///Link fully constructed register at list head
+                static inline
+                void
+                    enter(owning_ptr_register* rPtr,
+                          const char* type_name,
+                          const ATM_B_* alive_flag)
+                {
+                    std::lock_guard<MTX_> lck(list_mutex);
+                    if ( rPtr->b_census )
+                        return;     //already entered by its allocator
+
+                    rPtr->census_type       = type_name;
+                    rPtr->census_alive_flag = alive_flag;
+                    rPtr->census_birth      = std::chrono::steady_clock::now();
+                    rPtr->census_prev  = nullptr;
+                    rPtr->census_next  = head;
+                    if ( head != nullptr )
+                        head->census_prev = rPtr;
+                    head = rPtr;
+                    rPtr->b_census = true;
+                };
+                ///Unlink register
+                static inline
+                void
+                    leave(owning_ptr_register* rPtr)
+                {
+                    std::lock_guard<MTX_> lck(list_mutex);
+                    if ( !rPtr->b_census )
+                        return;     //pooled block already left
+
+                    if ( rPtr->census_prev != nullptr )
+                        rPtr->census_prev->census_next = rPtr->census_next;
+                    else
+                        head = rPtr->census_next;
+                    if ( rPtr->census_next != nullptr )
+                        rPtr->census_next->census_prev = rPtr->census_prev;
+                    rPtr->b_census = false;
+                };
 
-                template <typename RgstrType, typename OwnedType>
-                static inline __attribute__((always_inline))
+                ///Call fn(const owning_ptr_register&, size_t share_count) for every live register ( list locked )
+                template <typename Fn>
+                static inline
                 void
-                    destroy(RgstrType*& rPtr,
-                            OwnedType*& /**NOT USED*/)
+                    for_each(Fn&& fn)
                 {
-                    delete rPtr;    //delete register
+                    std::lock_guard<MTX_> lck(list_mutex);
+                    for ( auto rPtr = head; rPtr != nullptr; rPtr = rPtr->census_next )
+                        fn(*rPtr, rPtr->share_count.load(std::memory_order_relaxed));
                 };
 
             private:
-                /// - deleted
-                owning_ptr_register_v(const owning_ptr_register_v&) = delete;
-                owning_ptr_register_v(owning_ptr_register_v&&) = delete;
-        };  // end of owning_ptr_register_v class
+                static inline MTX_ list_mutex;                      ///< guards list links
+                static inline owning_ptr_register* head = nullptr;  ///< most recently entered register
+        };
+
+        inline
+        void
+            owning_ptr_register::census_leave(){
+            owning_ptr_census::leave(this);
+        };
+    #endif
 
         ///-------------------------------------------------------------------------------------------------------
-        ///HOLD OWNING_PTR SHARED BASE INFORMATION                          --------------------------------------
-        class owning_ptr_register_o
-        :
-            public owning_ptr_register
+        ///LOG-LINEAR LATENCY BUCKETS ( 16 linear sub-buckets per power of two, < 6.25% error )   ---------------
+        constexpr size_t   LAT_SUB_BITS_  = 4;
+        constexpr size_t   LAT_SUB_       = size_t(1) << LAT_SUB_BITS_;
+        constexpr size_t   LAT_MAX_EXP_   = 40;                                             ///< ~18 min in ns
+        constexpr size_t   LAT_BUCKETS_   = LAT_SUB_ + ( LAT_MAX_EXP_ - LAT_SUB_BITS_ + 1 ) * LAT_SUB_;
+        constexpr size_t   LAT_METRICS_   = 2;
+        constexpr uint64_t LAT_MAX_NS_    = ( uint64_t(1) << ( LAT_MAX_EXP_ + 1 ) ) - 1;   ///< larger values clamp
+
+        ///Bucket holding ns
+        inline constexpr
+        size_t
+            latency_bucket_of(uint64_t ns)
         {
-            template <typename RgstrType, typename OwnedType>
-            friend class owning_ptr_base;
+            if ( ns > LAT_MAX_NS_ )
+                ns = LAT_MAX_NS_;
+            if ( ns < LAT_SUB_ )
+                return size_t(ns);
+
+            const size_t exp = 63 - size_t(__builtin_clzll(ns));
+            const size_t sub = size_t( ns >> ( exp - LAT_SUB_BITS_ ) ) & ( LAT_SUB_ - 1 );
+            return LAT_SUB_ + ( exp - LAT_SUB_BITS_ ) * LAT_SUB_ + sub;
+        };
+        ///Smallest ns in bucket
+        inline constexpr
+        uint64_t
+            latency_bucket_lower(const size_t idx)
+        {
+            if ( idx < LAT_SUB_ )
+                return idx;
 
-            public:
-                ///Destructor
-                virtual ~owning_ptr_register_o()
-                {};
+            const size_t shift = ( idx - LAT_SUB_ ) / LAT_SUB_;
+            const size_t sub   = ( idx - LAT_SUB_ ) % LAT_SUB_;
+            return uint64_t( LAT_SUB_ + sub ) << shift;
+        };
+        ///Largest ns in bucket
+        inline constexpr
+        uint64_t
+            latency_bucket_upper(const size_t idx)
+        {
+            if ( idx < LAT_SUB_ )
+                return idx;
 
-            protected:
-                ///Default Constructor
-                owning_ptr_register_o()
-                {};
+            return latency_bucket_lower(idx) + ( uint64_t(1) << ( ( idx - LAT_SUB_ ) / LAT_SUB_ ) ) - 1;
+        };
 
-                template <typename RgstrType, typename OwnedType>
+    #ifdef OPTR_ENABLE_LATENCY_HISTOGRAM
+        ///-------------------------------------------------------------------------------------------------------
+        ///THREAD-LOCAL LATENCY HISTOGRAMS MERGED ON DEMAND ( OPTR_ENABLE_LATENCY_HISTOGRAM )   ------------------
+        ///- each thread bumps its own buckets ( relaxed load + store, no RMW ); exiting threads fold theirs
+        ///  into the retired totals
+        class owning_latency
+        {
+            using CLOCK_ = std::chrono::steady_clock;
+            using ATM_U64_ = std::atomic<uint64_t>;
+
+            public:
+                ///Current time
+                static inline __attribute__((always_inline))
+                CLOCK_::time_point
+                    now(){
+                    return CLOCK_::now();
+                };
+                ///Nanoseconds since t0
+                static inline __attribute__((always_inline))
+                uint64_t
+                    since(const CLOCK_::time_point t0){
+                    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(CLOCK_::now() - t0).count());
+                };
+
+                ///Lock mtx, recording time blocked ( uncontended : 0 without reading the clock )
+                template <typename Mutex>
                 static inline __attribute__((always_inline))
                 void
-                    destroy(RgstrType*& rPtr,
-                            OwnedType*& oPtr)
+                    timed_lock(Mutex& mtx)
                 {
-                    delete rPtr;    //delete register
-                    delete oPtr;    //delete held pointer
+                    if ( mtx.try_lock() )
+                    {
+                        record(owning_latency_metric::lock_wait, 0);
+                        return;
+                    }
+
+                    const auto t0 = now();
+                    mtx.lock();
+                    record(owning_latency_metric::lock_wait, since(t0));
                 };
 
-            private:
-                /// - deleted
-                owning_ptr_register_o(const owning_ptr_register_o&) = delete;
-                owning_ptr_register_o(owning_ptr_register_o&&) = delete;
-        };  // end of owning_ptr_register_o class
-
-        ///-------------------------------------------------------------------------------------------------------
-        ///PROVIDE POINTER AND LOCK ON LIVING_PTR UNTIL OUT OF SCOPE                    --------------------------
-        template <typename OwnedType>
-        class owning_ptr_mutex_lock
-        {
-            ///Using aliases
-            using OPTR_TYPE_  = OwnedType;                          ///< shared type
-            using OPTR_PTR_   = OPTR_TYPE_*;                        ///< shared type pointer
-            using OPTR_LOCK_ = owning_ptr_mutex_lock<OwnedType>;    ///< mutex-locked container
+                ///Add one sample to calling thread's histogram
+                static inline
+                void
+                    record(const owning_latency_metric metric,
+                           const uint64_t ns)
+                {
+                    const size_t m = size_t(metric);
+                    const size_t b = latency_bucket_of(ns);
+
+                    auto hist = tl_hist;
+                    if ( hist == nullptr )
+                    {
+                        if ( tl_closed )
+                        {
+                            retired[m][b].fetch_add(1, std::memory_order_relaxed);     //thread exiting
+                            return;
+                        }
+                        hist = open_thread();
+                    }
+
+                    auto& cnt = hist->counts[m][b];
+                    cnt.store(cnt.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                };
 
-            public:
-                ///Constructor ( lock )
-                owning_ptr_mutex_lock(MTX_& mtx,
-                                      ATM_B_& bAlv,
-                                      OPTR_PTR_ ptr)
-                :
-                    mutex(mtx),
-                    b_alive_r(bAlv),
-                    ltptr(ptr)
+                ///Sum every thread's buckets for metric into out[LAT_BUCKETS_]
+                static inline
+                void
+                    collect(const owning_latency_metric metric,
+                            uint64_t* out)
                 {
-                    mutex.lock();   //< lock mutex while owning_ptr_mutex_lock exists
+                    const size_t m = size_t(metric);
+                    std::lock_guard<MTX_> lck(list_mutex);
+                    for ( size_t b = 0; b < LAT_BUCKETS_; b++ )
+                        out[b] = retired[m][b].load(std::memory_order_relaxed);
+                    for ( auto hist : live )
+                        for ( size_t b = 0; b < LAT_BUCKETS_; b++ )
+                            out[b] += hist->counts[m][b].load(std::memory_order_relaxed);
                 };
-                ///Destructor ( unlock )
-                virtual ~owning_ptr_mutex_lock()
+
+                ///Zero every histogram ( samples recorded concurrently may survive )
+                static inline
+                void
+                    reset()
                 {
-                    mutex.unlock(); //< unlock mutex once owning_ptr_mutex_lock is destroyed
+                    std::lock_guard<MTX_> lck(list_mutex);
+                    for ( size_t m = 0; m < LAT_METRICS_; m++ )
+                        for ( size_t b = 0; b < LAT_BUCKETS_; b++ )
+                        {
+                            retired[m][b].store(0, std::memory_order_relaxed);
+                            for ( auto hist : live )
+                                hist->counts[m][b].store(0, std::memory_order_relaxed);
+                        }
                 };
 
-                ///Access Operator
-                inline __attribute__((always_inline))
-                OPTR_PTR_
-                    operator->(){
-                    return ltptr;
+            private:
+                ///One thread's buckets
+                struct thread_hist
+                {
+                    ATM_U64_ counts[LAT_METRICS_][LAT_BUCKETS_];
                 };
-                ///Access Operator ( const )
-                inline __attribute__((always_inline))
-                OPTR_PTR_
-                    operator->() const {
-                    return ltptr;
+                ///Folds thread's buckets into retired totals on thread exit
+                struct thread_guard
+                {
+                    ~thread_guard()
+                    {
+                        auto hist = tl_hist;
+                        tl_hist = nullptr;
+                        tl_closed = true;
+
+                        std::lock_guard<MTX_> lck(list_mutex);
+                        for ( size_t m = 0; m < LAT_METRICS_; m++ )
+                            for ( size_t b = 0; b < LAT_BUCKETS_; b++ )
+                                retired[m][b].fetch_add(hist->counts[m][b].load(std::memory_order_relaxed),
+                                                        std::memory_order_relaxed);
+                        for ( auto& lv : live )
+                            if ( lv == hist )
+                            {
+                                lv = live.back();
+                                live.pop_back();
+                                break;
+                            }
+                        delete hist;
+                    };
                 };
 
-                ///Owner-Alive status
-                inline __attribute__((always_inline))
-                bool
-                    alive() const {
-                    return b_alive_r;
+                ///Allocate and register calling thread's histogram
+                static inline
+                thread_hist*
+                    open_thread()
+                {
+                    thread_local thread_guard tl_guard;
+                    (void)tl_guard;
+
+                    auto hist = new thread_hist();  //value-initialized : all buckets 0
+                    {
+                        std::lock_guard<MTX_> lck(list_mutex);
+                        live.push_back(hist);
+                    }
+                    tl_hist = hist;
+                    return hist;
                 };
 
-            private:
-                MTX_& mutex;                ///< optr_register mutex
-                ATM_B_& b_alive_r;          ///< Original owner is-alive bool
-                OPTR_TYPE_* const ltptr;    ///< optr shared pointer
+                static inline thread_local thread_hist* tl_hist = nullptr; ///< calling thread's buckets
+                static inline thread_local bool tl_closed = false;         ///< calling thread is exiting
 
-                /// - deleted
-                owning_ptr_mutex_lock() = delete;
-                owning_ptr_mutex_lock(owning_ptr_mutex_lock&) = delete;
-        };  // end of owning_ptr_mutex_lock class
+                static inline MTX_ list_mutex;                             ///< guards live and merges
+                static inline std::vector<thread_hist*> live;              ///< running threads' buckets
+                static inline ATM_U64_ retired[LAT_METRICS_][LAT_BUCKETS_] = {};   ///< exited threads' buckets
+        };
+    #endif
 
         ///-------------------------------------------------------------------------------------------------------
-        ///OWNING_PTR BASE STRUCTURE CONTAINING REGISTER AND POINTER TO OWNEDTYPE               ------------------
-        template <typename RgstrType, typename OwnedType>
-        class owning_ptr_base
+        ///OWNER-ALIVE FLAG REGISTER PART ( owning_traits<T>::alive_flag )          ------------------------------
+        template <bool AliveFlag>
+        class owning_ptr_alive_part
         {
-            protected:
-                ///Base info struct using alias
-                using OPTR_RGSTR_ = RgstrType;                                      ///< owned_ptr register type
-                using OPTR_TYPE_  = OwnedType;                                      ///< shared type
-                using OPTR_PTR_   = OPTR_TYPE_*;                                    ///< shared type pointer
-                using OPTR_PTR_R_ = OPTR_TYPE_*&;
-                using OPTR_REF_   = OPTR_TYPE_&;                                    ///< shared type ref
-                using OPTR_C_REF_ = const OPTR_TYPE_&;                              ///< shared type const ref
-                using OPTR_M_REF_ = OPTR_TYPE_&&;                                   ///< shared type move ref
-                using OPTR_LOCK_  = optr_implem::owning_ptr_mutex_lock<OPTR_TYPE_>; ///< mutex-locked container
-
-                ///Friend cast template declare
-                template <typename T, typename PtrCastType>
-                friend class owning_ptr_base;
-
-                typedef typename optr_implem::owning_ptr_register_v OPTR_RGSTR_V_;      ///< volatile register
-                typedef typename optr_implem::owning_ptr_register_o OPTR_RGSTR_O_;      ///< owned register
-
             public:
-                ///Empty Constructor
+                ///Set owner alive status
                 inline __attribute__((always_inline))
-                owning_ptr_base()
-                :
-                    o_register(nullptr),
-                    o_pointer(nullptr)
-                {};
-                ///Destructor
-                virtual ~owning_ptr_base()
-                {
-                    clean_base();   //decrement share_count & remove register if last
+                void
+                    set_alive(const bool bAlv){
+                    this->b_alive = bAlv;
                 };
-
-                ///DeReference Operator
+                ///Owner alive status
                 inline __attribute__((always_inline))
-                OPTR_REF_
-                    operator*(){
-                    return *(this->o_pointer);
+                bool
+                    is_alive() const {
+                    return this->b_alive.load(std::memory_order_acquire);
                 };
-                ///Access Operator
+
+            #ifdef OPTR_ENABLE_CENSUS
+                ///Flag read by census
                 inline __attribute__((always_inline))
-                OPTR_PTR_
-                    operator->(){
-                    return this->o_pointer;
+                const ATM_B_*
+                    census_alive_flag_of() const {
+                    return &this->b_alive;
                 };
-                ///Access Operator ( const )
+            #endif
+
+                ATM_B_ b_alive{false};  ///< Indicates primary owner still 'alive'
+        };
+        ///Opted out : no flag, owner treated as always alive internally
+        template <>
+        class owning_ptr_alive_part<false>
+        {
+            public:
                 inline __attribute__((always_inline))
-                OPTR_PTR_
-                    operator->() const {
-                    return this->o_pointer;
+                void
+                    set_alive(const bool){
                 };
-                ///Get Raw Owning_Pointer
-                inline __attribute__((always_inline))
-                OPTR_PTR_
-                    get(){
-                    return this->o_pointer;
+                inline constexpr __attribute__((always_inline))
+                bool
+                    is_alive() const {
+                    return true;
                 };
-                ///Get Raw Owning_Pointer (const)
-                inline __attribute__((always_inline))
-                OPTR_PTR_
-                    get() const {
-                    return this->o_pointer;
+            #ifdef OPTR_ENABLE_CENSUS
+                inline constexpr __attribute__((always_inline))
+                const ATM_B_*
+                    census_alive_flag_of() const {
+                    return nullptr;
                 };
+            #endif
+        };
 
-                ///Assignment Operator
+        ///-------------------------------------------------------------------------------------------------------
+        ///OWNING THREAD REGISTER PART ( owning_traits<T>::track_owner_thread )     ------------------------------
+        template <bool TrackOwnerThread>
+        class owning_ptr_owner_thread_part
+        {
+            public:
+                ///Set thread currently owning ( std::thread::id() : in transfer to any thread )
                 inline __attribute__((always_inline))
                 void
-                    operator=(const owning_ptr_base& lPtr)
-                {
-                    if ( this->o_register != lPtr.o_register )
-                        clean_base();   //decrement share_count & remove register if last
-
-                    this->o_register = lPtr.o_register;
-                    this->o_pointer = lPtr.o_pointer;
-
-                    bump_up();      //increment share_count
+                    set_owner_thread(const std::thread::id tid){
+                    this->owner_thread.store(tid, std::memory_order_release);
                 };
-
-                ///Equality Operator
+                ///Thread currently owning
                 inline __attribute__((always_inline))
-                bool
-                    operator==(const owning_ptr_base& eq) const {
-                    return this->o_register == eq.o_register;
+                std::thread::id
+                    get_owner_thread() const {
+                    return this->owner_thread.load(std::memory_order_acquire);
                 };
-                ///InEquality Operator
+
+                std::atomic<std::thread::id> owner_thread{};    ///< thread holding primary owner
+        };
+        ///Opted out : nothing recorded, owner_thread() unavailable
+        template <>
+        class owning_ptr_owner_thread_part<false>
+        {
+            public:
                 inline __attribute__((always_inline))
-                bool
-                    operator!=(const owning_ptr_base& ieq) const {
-                    return this->o_register != ieq.o_register;
+                void
+                    set_owner_thread(const std::thread::id){
                 };
-                ///Equality Operator ( nullpointer )
-                inline __attribute__((always_inline))
-                bool
-                    operator==(std::nullptr_t){
-                    return this->o_pointer == nullptr;
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///EXCLUSIVE / SHARED / UPGRADEABLE MUTEX                                   ------------------------------
+        ///- writers and upgraders also hold upgrade_mtx, so no writer can slip in while an upgrader
+        ///  trades its shared hold for exclusive, or an exclusive holder downgrades
+        class owning_ptr_upgrade_mutex
+        {
+            public:
+                ///Exclusive
+                inline
+                void
+                    lock()
+                {
+                    this->upgrade_mtx.lock();
+                    this->rw_mtx.lock();
                 };
-                ///InEquality Operator ( nullpointer )
-                inline __attribute__((always_inline))
+                inline
+                void
+                    unlock()
+                {
+                    this->rw_mtx.unlock();
+                    this->upgrade_mtx.unlock();
+                };
+                inline
                 bool
-                    operator!=(std::nullptr_t){
-                    return this->o_pointer != nullptr;
+                    try_lock()
+                {
+                    if ( !this->upgrade_mtx.try_lock() )
+                        return false;
+                    if ( this->rw_mtx.try_lock() )
+                        return true;
+
+                    this->upgrade_mtx.unlock();
+                    return false;
+                };
+
+                ///Shared
+                inline
+                void
+                    lock_shared(){
+                    this->rw_mtx.lock_shared();
+                };
+                inline
+                void
+                    unlock_shared(){
+                    this->rw_mtx.unlock_shared();
+                };
+
+                ///Upgradeable ( shared, at most one holder, excludes writers )
+                inline
+                void
+                    lock_upgrade()
+                {
+                    this->upgrade_mtx.lock();
+                    this->rw_mtx.lock_shared();
+                };
+                inline
+                void
+                    unlock_upgrade()
+                {
+                    this->rw_mtx.unlock_shared();
+                    this->upgrade_mtx.unlock();
+                };
+
+                ///Upgradeable -> Exclusive ( waits for readers to leave )
+                inline
+                void
+                    unlock_upgrade_and_lock()
+                {
+                    this->rw_mtx.unlock_shared();
+                    this->rw_mtx.lock();
+                };
+                ///Exclusive -> Shared
+                inline
+                void
+                    unlock_and_lock_shared()
+                {
+                    this->rw_mtx.unlock();
+                    this->rw_mtx.lock_shared();
+                    this->upgrade_mtx.unlock();
+                };
+                ///Exclusive -> Upgradeable
+                inline
+                void
+                    unlock_and_lock_upgrade()
+                {
+                    this->rw_mtx.unlock();
+                    this->rw_mtx.lock_shared();
+                };
+
+            private:
+                MTX_ upgrade_mtx;           ///< held by writer or upgrader
+                std::shared_mutex rw_mtx;   ///< reader / writer state
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///MUTEX REGISTER PART ( owning_traits<T>::lockable / upgradeable )         ------------------------------
+        template <bool Lockable, bool Upgradeable>
+        class owning_ptr_lock_part
+        {
+            public:
+                MTX_ mutex_optr;        ///< Shared access mutex lock
+        };
+        ///Shared / upgrade state stored in register
+        template <>
+        class owning_ptr_lock_part<true, true>
+        {
+            public:
+                owning_ptr_upgrade_mutex mutex_optr;    ///< Shared access mutex lock ( shared / upgradeable )
+        };
+        ///Opted out : no mutex, get_lock() unavailable
+        template <bool Upgradeable>
+        class owning_ptr_lock_part<false, Upgradeable>
+        {};
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///ALIVE + MUTEX REGISTER STATE ( owning_traits<T>::isolate_refcount )      ------------------------------
+        template <typename Layout, bool Isolate = Layout::isolate_refcount>
+        class owning_ptr_state_part
+        :
+            public owning_ptr_alive_part<Layout::alive_flag>,
+            public owning_ptr_owner_thread_part<Layout::track_owner_thread>,
+            public owning_ptr_lock_part<Layout::lockable, Layout::upgradeable>
+        {};
+        ///Isolated : starts on its own cache line, so share_count RMWs don't invalidate lock waiters / alive() pollers
+        template <typename Layout>
+        class alignas(CACHE_LINE_) owning_ptr_state_part<Layout, true>
+        :
+            public owning_ptr_alive_part<Layout::alive_flag>,
+            public owning_ptr_owner_thread_part<Layout::track_owner_thread>,
+            public owning_ptr_lock_part<Layout::lockable, Layout::upgradeable>
+        {};
+
+        ///Held object storage alignment within register+object blocks
+        template <typename OwnedType>
+        constexpr size_t block_storage_align = ( owning_traits<OwnedType>::isolate_refcount && alignof(OwnedType) < CACHE_LINE_ )
+                                               ? CACHE_LINE_
+                                               : alignof(OwnedType);
+
+    #ifdef OPTR_ENABLE_NUMA
+        ///NUMA node calling thread currently runs on ( looked up on every call, threads may migrate )
+        ///- glibc getcpu() goes through the vDSO, the raw syscall is only the pre-2.29 fallback
+        inline
+        unsigned
+            numa_node_of_thread()
+        {
+            unsigned cpu = 0, node = 0;
+        #if defined(__GLIBC__) && ( __GLIBC__ > 2 || ( __GLIBC__ == 2 && __GLIBC_MINOR__ >= 29 ) )
+            if ( ::getcpu(&cpu, &node) != 0 )
+                node = 0;
+        #else
+            if ( syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 )
+                node = 0;
+        #endif
+            return node;
+        };
+    #endif
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///HOLD LIVING_PTR SHARED BASE INFORMATION                                  ------------------------------
+        template <typename Layout>
+        class owning_ptr_register_v
+        :
+            public owning_ptr_register,
+            public owning_ptr_state_part<Layout>
+        {
+            template <typename RgstrType, typename OwnedType>
+            friend class owning_ptr_base;
+
+            public:
+                using layout = Layout;  ///< register layout
+
+                ///Destructor
+                virtual ~owning_ptr_register_v()
+                {
+                #ifdef OPTR_ENABLE_CENSUS
+                    this->census_leave();   //before alive part is destroyed
+                #endif
+                };
+
+            #ifdef OPTR_ENABLE_CENSUS
+                ///Add constructed register to live census
+                inline
+                void
+                    census_enter(const char* type_name){
+                    owning_ptr_census::enter(this, type_name, this->census_alive_flag_of());
+                };
+            #endif
+
+            protected:
+                ///Default Constructor
+                owning_ptr_register_v()
+                {};
+
+                template <typename RgstrType, typename OwnedType>
+                static inline __attribute__((always_inline))
+                void
+                    destroy(RgstrType*& rPtr,
+                            OwnedType*& /**NOT USED*/)
+                {
+                    delete rPtr;    //delete register
+                };
+
+            private:
+                /// - deleted
+                owning_ptr_register_v(const owning_ptr_register_v&) = delete;
+                owning_ptr_register_v(owning_ptr_register_v&&) = delete;
+        };  // end of owning_ptr_register_v class
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///CLOSURE QUEUED IN OWNING_PTR_O MAILBOX                                   ------------------------------
+        class owning_ptr_post_node
+        {
+            public:
+                ///Destructor
+                virtual ~owning_ptr_post_node()
+                {};
+
+                ///Run posted closure against held object
+                virtual void
+                    run() = 0;
+
+                owning_ptr_post_node* next = nullptr;   ///< next node ( newest -> oldest while queued )
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///TYPED CLOSURE BOUND TO HELD POINTER                                      ------------------------------
+        template <typename OwnedType, typename Fn>
+        class owning_ptr_post_task
+        :
+            public owning_ptr_post_node
+        {
+            public:
+                ///Init Constructor
+                template <typename FnArg>
+                owning_ptr_post_task(OwnedType* ptr,
+                                     FnArg&& fn)
+                :
+                    o_pointer(ptr),
+                    post_fn(std::forward<FnArg>(fn))
+                {};
+
+                ///Run posted closure against held object
+                virtual void
+                    run() override
+                {
+                    post_fn(*(this->o_pointer));
+                };
+
+            private:
+                OwnedType* const o_pointer;     ///< pointer as seen by posting owning_ptr ( cast-correct )
+                Fn post_fn;                     ///< posted closure
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///MAILBOX REGISTER PART ( owning_traits<T>::mailbox )                      ------------------------------
+        template <bool Mailbox>
+        class owning_ptr_mailbox_part
+        {
+            public:
+                ///Destructor
+                ~owning_ptr_mailbox_part()
+                {
+                    //nothing can be left queued once last sharer is gone, but never leak
+                    auto node = this->post_head.exchange(nullptr, std::memory_order_acquire);
+                    while ( node != nullptr )
+                    {
+                        auto next = node->next;
+                        delete node;
+                        node = next;
+                    }
+                };
+
+                std::atomic<owning_ptr_post_node*> post_head{nullptr};  ///< mailbox ( lock-free MPSC stack )
+                ATM_U_ post_pending{0};                                 ///< closures posted but not yet run
+        };
+        ///Opted out : no mailbox, post() unavailable
+        template <>
+        class owning_ptr_mailbox_part<false>
+        {};
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///HOLD OWNING_PTR SHARED BASE INFORMATION                          --------------------------------------
+        template <typename Layout>
+        class owning_ptr_register_o
+        :
+            public owning_ptr_register,
+            public owning_ptr_state_part<Layout>,
+            public owning_ptr_mailbox_part<Layout::mailbox>
+        {
+            template <typename RgstrType, typename OwnedType>
+            friend class owning_ptr_base;
+            template <typename OwnedType>
+            friend class optr::owning_ptr_o;
+            friend class owning_ptr_access;
+
+            public:
+                using layout = Layout;  ///< register layout
+
+                ///Destructor
+                virtual ~owning_ptr_register_o()
+                {
+                #ifdef OPTR_ENABLE_CENSUS
+                    this->census_leave();   //before alive part is destroyed
+                #endif
+                };
+
+            #ifdef OPTR_ENABLE_CENSUS
+                ///Add constructed register to live census
+                inline
+                void
+                    census_enter(const char* type_name){
+                    owning_ptr_census::enter(this, type_name, this->census_alive_flag_of());
+                };
+            #endif
+
+            protected:
+                ///Default Constructor
+                owning_ptr_register_o()
+                {};
+
+                template <typename RgstrType, typename OwnedType>
+                static inline __attribute__((always_inline))
+                void
+                    destroy(RgstrType*& rPtr,
+                            OwnedType*& oPtr)
+                {
+                #ifdef OPTR_ENABLE_LATENCY_HISTOGRAM
+                    const auto t0 = owning_latency::now();
+                #endif
+
+                    if ( !rPtr->release_block() )   //register+object block handed back to its allocator
+                    {
+                        delete rPtr;    //delete register
+                        delete oPtr;    //delete held pointer
+                    }
+
+                #ifdef OPTR_ENABLE_LATENCY_HISTOGRAM
+                    owning_latency::record(owning_latency_metric::destroy, owning_latency::since(t0));
+                #endif
+                };
+
+                ///Push closure onto mailbox ( returns true if caller must drain )
+                inline __attribute__((always_inline))
+                bool
+                    enqueue_post(owning_ptr_post_node* node)
+                {
+                    //count first: the 0 -> 1 transition hands out the single drainer role
+                    const bool b_drainer = this->post_pending.fetch_add(1, std::memory_order_acq_rel) == 0;
+
+                    node->next = this->post_head.load(std::memory_order_relaxed);
+                    while ( !this->post_head.compare_exchange_weak(node->next, node,
+                                                                   std::memory_order_release,
+                                                                   std::memory_order_relaxed) )
+                    {};
+
+                    return b_drainer;
+                };
+                ///Run queued closures in posting order until mailbox is empty ( drainer only )
+                ///- closures queued after owner died are dropped without running
+                ///- a throwing closure does not stop the drain: the rest still run, the drainer role is released,
+                ///  then the first exception is rethrown to the draining poster
+                inline
+                void
+                    drain_posts()
+                {
+                    std::exception_ptr first_ex;
+                    while ( true )
+                    {
+                        auto batch = this->post_head.exchange(nullptr, std::memory_order_acquire);
+                        if ( batch == nullptr )
+                        {
+                            std::this_thread::yield();  //poster counted but not yet linked
+                            continue;
+                        }
+
+                        owning_ptr_post_node* fifo = nullptr;   //reverse into posting order
+                        while ( batch != nullptr )
+                        {
+                            auto next = batch->next;
+                            batch->next = fifo;
+                            fifo = batch;
+                            batch = next;
+                        }
+
+                        size_t n_run = 0;
+                        while ( fifo != nullptr )
+                        {
+                            auto next = fifo->next;
+                            if ( this->is_alive() )
+                            {
+                                try
+                                {
+                                    fifo->run();
+                                }
+                                catch (...)
+                                {
+                                    if ( !first_ex )
+                                        first_ex = std::current_exception();
+                                }
+                            }
+                            delete fifo;
+                            fifo = next;
+                            n_run++;
+                        }
+
+                        if ( this->post_pending.fetch_sub(n_run, std::memory_order_acq_rel) == n_run )
+                        {
+                            if ( first_ex )
+                                std::rethrow_exception(first_ex);
+                            return;     //mailbox empty, drainer role released
+                        }
+                    }
+                };
+
+            private:
+                /// - deleted
+                owning_ptr_register_o(const owning_ptr_register_o&) = delete;
+                owning_ptr_register_o(owning_ptr_register_o&&) = delete;
+        };  // end of owning_ptr_register_o class
+
+        ///Register footprint per layout ( opted-out parts must cost nothing, defaults stay one cache line )
+        using OPTR_LAYOUT_DEFAULT_ = owning_register_layout<true, true>;
+        using OPTR_LAYOUT_BARE_    = owning_register_layout<false, false>;
+    #ifndef OPTR_ENABLE_CENSUS
+        static_assert(sizeof(owning_ptr_register) == sizeof(void*) + sizeof(ATM_U_), "owning_ptr_register must stay vptr + share_count");
+    #endif
+        static_assert(sizeof(owning_ptr_register_o<OPTR_LAYOUT_DEFAULT_>) == sizeof(owning_ptr_register) + alignof(MTX_) + sizeof(MTX_)
+                      && sizeof(owning_ptr_register_v<OPTR_LAYOUT_DEFAULT_>) == sizeof(owning_ptr_register) + alignof(MTX_) + sizeof(MTX_),
+                      "default register must hold only share_count, alive flag and mutex");
+        static_assert(sizeof(owning_ptr_register_o<OPTR_LAYOUT_BARE_>) == sizeof(owning_ptr_register)
+                      && sizeof(owning_ptr_register_v<OPTR_LAYOUT_BARE_>) == sizeof(owning_ptr_register),
+                      "register without alive flag and mutex must hold only share_count");
+
+    #ifdef OPTR_LOCK_ORDER_CHECK
+        ///-------------------------------------------------------------------------------------------------------
+        ///LOCK-ORDER GRAPH OVER LOCK CLASSES ( OPTR_LOCK_ORDER_CHECK )             ------------------------------
+        ///- nodes are owning_traits<T>::lock_class ( or held type name ), edge A -> B once B was locked holding A
+        ///- a new edge closing a cycle is reported once, whether or not threads actually deadlocked
+        ///- nesting locks of the same class is not checked
+        class owning_lock_order
+        {
+            public:
+                using REPORT_FN_ = std::function<void(const std::vector<std::string>&)>;  ///< cycle, first == last
+
+                ///Lock class of OwnedType
+                template <typename OwnedType>
+                static inline
+                const char*
+                    class_of()
+                {
+                    if constexpr ( owning_traits<OwnedType>::lock_class != nullptr )
+                        return owning_traits<OwnedType>::lock_class;
+                    else
+                        return typeid(OwnedType).name();
+                };
+
+                ///Record edges from every held class, before blocking on lck_class
+                static inline
+                void
+                    on_lock(const char* lck_class)
+                {
+                    auto& tl = thread_state();
+                    for ( auto held : tl.held )
+                    {
+                        if ( held == lck_class || tl.known.count({ held, lck_class }) != 0 )
+                            continue;   //same class, or edge already checked by this thread
+
+                        add_edge(held, lck_class);
+                        tl.known.insert({ held, lck_class });
+                    }
+                    tl.held.push_back(lck_class);
+                };
+                ///Forget most recent hold of lck_class
+                static inline
+                void
+                    on_unlock(const char* lck_class)
+                {
+                    auto& held = thread_state().held;
+                    for ( auto it = held.rbegin(); it != held.rend(); ++it )
+                    {
+                        if ( *it == lck_class )
+                        {
+                            held.erase(std::next(it).base());
+                            return;
+                        }
+                    }
+                };
+
+                ///Replace inversion report ( default prints cycle to stderr )
+                static inline
+                void
+                    set_report(REPORT_FN_ fn)
+                {
+                    std::lock_guard<MTX_> lck(graph_mutex());
+                    report_fn() = std::move(fn);
+                };
+
+            private:
+                ///Pointer pair hash for thread-local edge cache
+                struct edge_hash
+                {
+                    inline
+                    size_t
+                        operator()(const std::pair<const char*, const char*>& edg) const {
+                        return std::hash<const void*>()(edg.first) * 31 + std::hash<const void*>()(edg.second);
+                    };
+                };
+                ///Per-thread held classes and already-checked edges
+                struct thread_data
+                {
+                    std::vector<const char*> held;
+                    std::unordered_set<std::pair<const char*, const char*>, edge_hash> known;
+                };
+
+                static inline
+                thread_data&
+                    thread_state()
+                {
+                    thread_local thread_data tl;
+                    return tl;
+                };
+                static inline
+                MTX_&
+                    graph_mutex()
+                {
+                    static MTX_ mtx;
+                    return mtx;
+                };
+                static inline
+                std::unordered_map<std::string, std::unordered_set<std::string>>&
+                    graph()
+                {
+                    static std::unordered_map<std::string, std::unordered_set<std::string>> edges;
+                    return edges;
+                };
+                static inline
+                REPORT_FN_&
+                    report_fn()
+                {
+                    static REPORT_FN_ fn = [](const std::vector<std::string>& cycle)
+                    {
+                        std::string msg = "optr: lock-order inversion:";
+                        for ( const auto& node : cycle )
+                            msg += " " + node + ( &node != &cycle.back() ? " ->" : "" );
+                        std::fprintf(stderr, "%s\n", msg.c_str());
+                    };
+                    return fn;
+                };
+
+                ///Add edge from -> to, reporting a cycle if to already reaches from
+                static inline
+                void
+                    add_edge(const char* from,
+                             const char* to)
+                {
+                    std::vector<std::string> cycle;
+                    REPORT_FN_ report;
+                    {
+                        std::lock_guard<MTX_> lck(graph_mutex());
+                        auto& edges = graph();
+                        if ( !edges[from].insert(to).second )
+                            return;     //seen by another thread
+
+                        if ( find_path(edges, to, from, cycle) )
+                        {
+                            cycle.insert(cycle.begin(), from);
+                            report = report_fn();   //copied under lock, set_report() may replace it
+                        }
+                    }
+
+                    if ( report )
+                        report(cycle);      //outside lock, may lock owning_ptrs itself
+                };
+                ///Depth-first path search src -> dst ( path includes both ends )
+                static inline
+                bool
+                    find_path(const std::unordered_map<std::string, std::unordered_set<std::string>>& edges,
+                              const std::string& src,
+                              const std::string& dst,
+                              std::vector<std::string>& path)
+                {
+                    std::unordered_set<std::string> seen;
+                    std::vector<std::pair<std::string, bool>> stack{ { src, false } };
+                    while ( !stack.empty() )
+                    {
+                        auto [node, b_done] = stack.back();
+                        stack.pop_back();
+                        if ( b_done )
+                        {
+                            path.pop_back();
+                            continue;
+                        }
+                        if ( !seen.insert(node).second )
+                            continue;
+
+                        path.push_back(node);
+                        if ( node == dst )
+                            return true;
+                        stack.push_back({ node, true });
+
+                        auto out = edges.find(node);
+                        if ( out != edges.end() )
+                            for ( const auto& next : out->second )
+                                stack.push_back({ next, false });
+                    }
+                    return false;
+                };
+        };
+    #endif
+
+        ///Lock-order bookkeeping for OwnedType's lock class ( no-op unless OPTR_LOCK_ORDER_CHECK )
+        template <typename OwnedType>
+        inline __attribute__((always_inline))
+        void
+            lock_order_enter()
+        {
+        #ifdef OPTR_LOCK_ORDER_CHECK
+            owning_lock_order::on_lock(owning_lock_order::class_of<OwnedType>());
+        #endif
+        };
+        template <typename OwnedType>
+        inline __attribute__((always_inline))
+        void
+            lock_order_leave()
+        {
+        #ifdef OPTR_LOCK_ORDER_CHECK
+            owning_lock_order::on_unlock(owning_lock_order::class_of<OwnedType>());
+        #endif
+        };
+
+        template <typename RgstrType, typename OwnedType>
+        class owning_ptr_shared_lock;
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///PROVIDE POINTER AND LOCK ON LIVING_PTR UNTIL OUT OF SCOPE                    --------------------------
+        ///- movable, no vtable : tagged register pointer ( low bit : mutex held ) and object pointer
+        ///- must be unlocked ( destroyed, unlock() ) on the thread that locked it
+        template <typename RgstrType, typename OwnedType>
+        class owning_ptr_mutex_lock
+        {
+            ///Using aliases
+            using OPTR_TYPE_  = OwnedType;                                      ///< shared type
+            using OPTR_PTR_   = OPTR_TYPE_*;                                    ///< shared type pointer
+            using OPTR_LOCK_ = owning_ptr_mutex_lock<RgstrType, OwnedType>;     ///< mutex-locked container
+            using OPTR_MTX_  = decltype(RgstrType::mutex_optr);                 ///< register mutex type
+
+            static constexpr uintptr_t OWNS_BIT_ = 1;   ///< tag bit in rgstr_bits
+            static_assert(alignof(RgstrType) > OWNS_BIT_, "register alignment leaves no tag bit");
+
+            public:
+                ///Empty Constructor ( holds nothing )
+                owning_ptr_mutex_lock()
+                :
+                    rgstr_bits(0),
+                    ltptr(nullptr)
+                {};
+                ///Constructor ( lock )
+                owning_ptr_mutex_lock(RgstrType& rgstr,
+                                      OPTR_PTR_ ptr)
+                :
+                    rgstr_bits(reinterpret_cast<uintptr_t>(&rgstr) | OWNS_BIT_),
+                    ltptr(ptr)
+                {
+                    lock_order_enter<OwnedType>();
+                #ifdef OPTR_ENABLE_LATENCY_HISTOGRAM
+                    owning_latency::timed_lock(rgstr.mutex_optr);
+                #else
+                    rgstr.mutex_optr.lock();    //< lock mutex while owning_ptr_mutex_lock exists
+                #endif
+                };
+                ///Constructor ( adopt mutex already locked exclusive by caller )
+                owning_ptr_mutex_lock(RgstrType& rgstr,
+                                      OPTR_PTR_ ptr,
+                                      std::adopt_lock_t)
+                :
+                    rgstr_bits(reinterpret_cast<uintptr_t>(&rgstr) | OWNS_BIT_),
+                    ltptr(ptr)
+                {};
+                ///Move Constructor
+                owning_ptr_mutex_lock(OPTR_LOCK_&& mv) noexcept
+                :
+                    rgstr_bits(mv.rgstr_bits),
+                    ltptr(mv.ltptr)
+                {
+                    mv.rgstr_bits = 0;
+                    mv.ltptr = nullptr;
+                };
+                ///Destructor ( unlock )
+                ~owning_ptr_mutex_lock(){
+                    unlock();   //< unlock mutex once owning_ptr_mutex_lock is destroyed
+                };
+
+                ///Move Assignment ( unlocks currently held mutex first )
+                inline
+                OPTR_LOCK_&
+                    operator=(OPTR_LOCK_&& mv) noexcept
+                {
+                    if ( this != &mv )
+                    {
+                        unlock();
+                        this->rgstr_bits = mv.rgstr_bits;
+                        this->ltptr = mv.ltptr;
+                        mv.rgstr_bits = 0;
+                        mv.ltptr = nullptr;
+                    }
+                    return *this;
+                };
+
+                ///Unlock now ( no-op if not held )
+                inline __attribute__((always_inline))
+                void
+                    unlock()
+                {
+                    if ( !owns_lock() )
+                        return;     //moved from, released, downgraded or unlocked
+
+                    this->rgstr_bits &= ~OWNS_BIT_;
+                    get_register()->mutex_optr.unlock();
+                    lock_order_leave<OwnedType>();
+                };
+                ///Give up mutex without unlocking, returning it ( caller unlocks )
+                inline
+                OPTR_MTX_*
+                    release()
+                {
+                    if ( !owns_lock() )
+                        return nullptr;
+
+                    auto mtx = &get_register()->mutex_optr;
+                    this->rgstr_bits = 0;
+                    this->ltptr = nullptr;
+                    lock_order_leave<OwnedType>();
+                    return mtx;
+                };
+                ///Mutex held by this container
+                inline __attribute__((always_inline))
+                bool
+                    owns_lock() const {
+                    return ( this->rgstr_bits & OWNS_BIT_ ) != 0;
+                };
+                inline __attribute__((always_inline))
+                explicit operator bool() const {
+                    return owns_lock();
+                };
+
+                ///Exclusive -> Shared without letting a writer in ( this lock no longer holds mutex )
+                inline
+                owning_ptr_shared_lock<RgstrType, OwnedType>
+                    downgrade()
+                {
+                    static_assert(RgstrType::layout::upgradeable, "downgrade() unavailable: owning_traits<T>::upgradeable is false");
+                    assert(owns_lock() && "downgrade() on a lock that does not hold the mutex");
+                    auto rgstr = get_register();
+                    rgstr->mutex_optr.unlock_and_lock_shared();
+                    this->rgstr_bits &= ~OWNS_BIT_;
+                    return owning_ptr_shared_lock<RgstrType, OwnedType>(*rgstr, this->ltptr, std::adopt_lock);
+                };
+
+                ///Access Operator
+                inline __attribute__((always_inline))
+                OPTR_PTR_
+                    operator->(){
+                    return ltptr;
+                };
+                ///Access Operator ( const )
+                inline __attribute__((always_inline))
+                OPTR_PTR_
+                    operator->() const {
+                    return ltptr;
+                };
+
+                ///Owner-Alive status
+                inline __attribute__((always_inline))
+                bool
+                    alive() const
+                {
+                    static_assert(RgstrType::layout::alive_flag, "alive() unavailable: owning_traits<T>::alive_flag is false");
+                    return get_register() != nullptr && get_register()->b_alive;
+                };
+
+            private:
+                ///Untagged register pointer
+                inline __attribute__((always_inline))
+                RgstrType*
+                    get_register() const {
+                    return reinterpret_cast<RgstrType*>(this->rgstr_bits & ~OWNS_BIT_);
+                };
+
+                uintptr_t rgstr_bits;       ///< optr_register holding mutex and is-alive bool | OWNS_BIT_
+                OPTR_TYPE_* ltptr;          ///< optr shared pointer
+
+                /// - deleted
+                owning_ptr_mutex_lock(const OPTR_LOCK_&) = delete;
+                OPTR_LOCK_& operator=(const OPTR_LOCK_&) = delete;
+        };  // end of owning_ptr_mutex_lock class
+
+        ///Held type used only to check lock container layout
+        struct owning_ptr_lock_probe
+        {};
+        using OPTR_PROBE_LOCK_ = owning_ptr_mutex_lock<register_o_of<owning_ptr_lock_probe>, owning_ptr_lock_probe>;
+        static_assert(sizeof(OPTR_PROBE_LOCK_) == 2 * sizeof(void*), "owning_ptr_mutex_lock must stay two words");
+        static_assert(std::is_nothrow_move_constructible<OPTR_PROBE_LOCK_>::value
+                      && std::is_nothrow_move_assignable<OPTR_PROBE_LOCK_>::value,
+                      "owning_ptr_mutex_lock must move without throwing ( containers relocate it )");
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///PROVIDE CONST POINTER AND SHARED LOCK UNTIL OUT OF SCOPE                     --------------------------
+        template <typename RgstrType, typename OwnedType>
+        class owning_ptr_shared_lock
+        {
+            using OPTR_C_PTR_ = const OwnedType*;   ///< shared type const pointer
+
+            public:
+                ///Constructor ( lock shared )
+                owning_ptr_shared_lock(RgstrType& rgstr,
+                                       OwnedType* ptr)
+                :
+                    o_register(&rgstr),
+                    ltptr(ptr)
+                {
+                    lock_order_enter<OwnedType>();
+                    o_register->mutex_optr.lock_shared();
+                };
+                ///Constructor ( adopt mutex already locked shared by caller )
+                owning_ptr_shared_lock(RgstrType& rgstr,
+                                       OwnedType* ptr,
+                                       std::adopt_lock_t)
+                :
+                    o_register(&rgstr),
+                    ltptr(ptr)
+                {};
+                ///Move Constructor
+                owning_ptr_shared_lock(owning_ptr_shared_lock&& mv)
+                :
+                    o_register(mv.o_register),
+                    ltptr(mv.ltptr)
+                {
+                    mv.o_register = nullptr;
+                };
+                ///Destructor ( unlock shared )
+                ~owning_ptr_shared_lock()
+                {
+                    if ( o_register == nullptr )
+                        return;     //moved from
+
+                    o_register->mutex_optr.unlock_shared();
+                    lock_order_leave<OwnedType>();
+                };
+
+                ///Access Operator ( read only )
+                inline __attribute__((always_inline))
+                OPTR_C_PTR_
+                    operator->() const {
+                    return ltptr;
+                };
+
+                ///Owner-Alive status
+                inline __attribute__((always_inline))
+                bool
+                    alive() const
+                {
+                    static_assert(RgstrType::layout::alive_flag, "alive() unavailable: owning_traits<T>::alive_flag is false");
+                    return o_register != nullptr && o_register->b_alive;
+                };
+
+            private:
+                RgstrType* o_register;      ///< optr_register holding mutex ( nullptr : moved from )
+                OwnedType* ltptr;           ///< optr shared pointer
+
+                /// - deleted
+                owning_ptr_shared_lock(const owning_ptr_shared_lock&) = delete;
+                owning_ptr_shared_lock& operator=(const owning_ptr_shared_lock&) = delete;
+        };  // end of owning_ptr_shared_lock class
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///PROVIDE CONST POINTER AND UPGRADEABLE LOCK UNTIL OUT OF SCOPE                --------------------------
+        ///- concurrent with shared locks, excludes writers and other upgraders
+        template <typename RgstrType, typename OwnedType>
+        class owning_ptr_upgrade_lock
+        {
+            using OPTR_C_PTR_ = const OwnedType*;                               ///< shared type const pointer
+            using OPTR_LOCK_  = owning_ptr_mutex_lock<RgstrType, OwnedType>;    ///< exclusive container
+
+            public:
+                ///Constructor ( lock upgradeable )
+                owning_ptr_upgrade_lock(RgstrType& rgstr,
+                                        OwnedType* ptr)
+                :
+                    o_register(&rgstr),
+                    ltptr(ptr)
+                {
+                    lock_order_enter<OwnedType>();
+                    o_register->mutex_optr.lock_upgrade();
+                };
+                ///Move Constructor
+                owning_ptr_upgrade_lock(owning_ptr_upgrade_lock&& mv)
+                :
+                    o_register(mv.o_register),
+                    ltptr(mv.ltptr)
+                {
+                    mv.o_register = nullptr;
+                };
+                ///Destructor ( unlock upgradeable )
+                ~owning_ptr_upgrade_lock()
+                {
+                    if ( o_register == nullptr )
+                        return;     //moved from or upgraded
+
+                    o_register->mutex_optr.unlock_upgrade();
+                    lock_order_leave<OwnedType>();
+                };
+
+                ///Upgradeable -> Exclusive, with no writer in between ( this lock no longer holds mutex )
+                inline
+                OPTR_LOCK_
+                    upgrade()
+                {
+                    assert(o_register != nullptr && "upgrade() on a moved-from or already upgraded lock");
+                    auto rgstr = o_register;
+                    rgstr->mutex_optr.unlock_upgrade_and_lock();
+                    o_register = nullptr;
+                    return OPTR_LOCK_{ *rgstr, ltptr, std::adopt_lock };
+                };
+
+                ///Access Operator ( read only )
+                inline __attribute__((always_inline))
+                OPTR_C_PTR_
+                    operator->() const {
+                    return ltptr;
+                };
+
+                ///Owner-Alive status
+                inline __attribute__((always_inline))
+                bool
+                    alive() const
+                {
+                    static_assert(RgstrType::layout::alive_flag, "alive() unavailable: owning_traits<T>::alive_flag is false");
+                    return o_register != nullptr && o_register->b_alive;
+                };
+
+            private:
+                RgstrType* o_register;      ///< optr_register holding mutex ( nullptr : moved from / upgraded )
+                OwnedType* ltptr;           ///< optr shared pointer
+
+                /// - deleted
+                owning_ptr_upgrade_lock(const owning_ptr_upgrade_lock&) = delete;
+                owning_ptr_upgrade_lock& operator=(const owning_ptr_upgrade_lock&) = delete;
+        };  // end of owning_ptr_upgrade_lock class
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///OWNING_PTR BASE STRUCTURE CONTAINING REGISTER AND POINTER TO OWNEDTYPE               ------------------
+        template <typename RgstrType, typename OwnedType>
+        class owning_ptr_base
+        {
+            protected:
+                ///Base info struct using alias
+                using OPTR_RGSTR_ = RgstrType;                                      ///< owned_ptr register type
+                using OPTR_TYPE_  = OwnedType;                                      ///< shared type
+                using OPTR_PTR_   = OPTR_TYPE_*;                                    ///< shared type pointer
+                using OPTR_PTR_R_ = OPTR_TYPE_*&;
+                using OPTR_REF_   = OPTR_TYPE_&;                                    ///< shared type ref
+                using OPTR_C_REF_ = const OPTR_TYPE_&;                              ///< shared type const ref
+                using OPTR_M_REF_ = OPTR_TYPE_&&;                                   ///< shared type move ref
+                using OPTR_LOCK_  = optr_implem::owning_ptr_mutex_lock<RgstrType, OPTR_TYPE_>;  ///< mutex-locked container
+                using OPTR_S_LOCK_ = optr_implem::owning_ptr_shared_lock<RgstrType, OPTR_TYPE_>;   ///< shared-locked container
+                using OPTR_U_LOCK_ = optr_implem::owning_ptr_upgrade_lock<RgstrType, OPTR_TYPE_>;  ///< upgradeable-locked container
+
+                ///Friend cast template declare
+                template <typename T, typename PtrCastType>
+                friend class owning_ptr_base;
+                ///Register identity for bulk facilities
+                friend class optr_implem::owning_ptr_access;
+
+                typedef optr_implem::register_v_of<OwnedType> OPTR_RGSTR_V_;      ///< volatile register
+                typedef optr_implem::register_o_of<OwnedType> OPTR_RGSTR_O_;      ///< owned register
+
+            public:
+                ///Empty Constructor
+                inline __attribute__((always_inline))
+                owning_ptr_base()
+                :
+                    o_register(nullptr),
+                    o_pointer(nullptr)
+                {};
+                ///Destructor
+                virtual ~owning_ptr_base()
+                {
+                    clean_base();   //decrement share_count & remove register if last
+                };
+
+                ///DeReference Operator
+                inline __attribute__((always_inline))
+                OPTR_REF_
+                    operator*(){
+                    return *(this->o_pointer);
+                };
+                ///Access Operator
+                inline __attribute__((always_inline))
+                OPTR_PTR_
+                    operator->(){
+                    return this->o_pointer;
+                };
+                ///Access Operator ( const )
+                inline __attribute__((always_inline))
+                OPTR_PTR_
+                    operator->() const {
+                    return this->o_pointer;
+                };
+                ///Get Raw Owning_Pointer
+                inline __attribute__((always_inline))
+                OPTR_PTR_
+                    get(){
+                    return this->o_pointer;
+                };
+                ///Get Raw Owning_Pointer (const)
+                inline __attribute__((always_inline))
+                OPTR_PTR_
+                    get() const {
+                    return this->o_pointer;
+                };
+
+                ///Assignment Operator
+                inline __attribute__((always_inline))
+                void
+                    operator=(const owning_ptr_base& lPtr)
+                {
+                    if ( this->o_register == lPtr.o_register )
+                    {
+                        this->o_pointer = lPtr.o_pointer;   //same register already shared
+                        return;
+                    }
+
+                    //take new share before dropping old, lPtr may live inside the object being released
+                    auto n_register = lPtr.o_register;
+                    auto n_pointer = lPtr.o_pointer;
+                    if ( n_register != nullptr )
+                        n_register->operator++();   //increment share_count
+
+                    clean_base();   //decrement share_count & remove register if last
+
+                    this->o_register = n_register;
+                    this->o_pointer = n_pointer;
+                };
+
+                ///Equality Operator
+                inline __attribute__((always_inline))
+                bool
+                    operator==(const owning_ptr_base& eq) const {
+                    return this->o_register == eq.o_register;
+                };
+                ///InEquality Operator
+                inline __attribute__((always_inline))
+                bool
+                    operator!=(const owning_ptr_base& ieq) const {
+                    return this->o_register != ieq.o_register;
+                };
+                ///Equality Operator ( nullpointer )
+                inline __attribute__((always_inline))
+                bool
+                    operator==(std::nullptr_t){
+                    return this->o_pointer == nullptr;
+                };
+                ///InEquality Operator ( nullpointer )
+                inline __attribute__((always_inline))
+                bool
+                    operator!=(std::nullptr_t){
+                    return this->o_pointer != nullptr;
                 };
 
                 ///Returns mutex-locked container with shared pointer
                 inline __attribute__((always_inline))
                 OPTR_LOCK_
-                    get_lock(){
-                    return OPTR_LOCK_{ this->o_register->mutex_optr,
-                                       this->o_register->b_alive,
+                    get_lock()
+                {
+                    static_assert(RgstrType::layout::lockable, "get_lock() unavailable: owning_traits<T>::lockable is false");
+                    return OPTR_LOCK_{ *this->o_register,
                                        this->o_pointer };
                 };
                 ///Returns mutex-locked container with shared pointer ( const )
                 inline __attribute__((always_inline))
                 OPTR_LOCK_
-                    get_lock() const {
-                    return OPTR_LOCK_{ this->o_register->mutex_optr,
-                                       this->o_register->b_alive,
+                    get_lock() const
+                {
+                    static_assert(RgstrType::layout::lockable, "get_lock() unavailable: owning_traits<T>::lockable is false");
+                    return OPTR_LOCK_{ *this->o_register,
                                        this->o_pointer };
                 };
+                ///Returns shared-locked read-only container ( concurrent with other shared / upgradeable locks )
+                inline __attribute__((always_inline))
+                OPTR_S_LOCK_
+                    get_shared_lock() const
+                {
+                    static_assert(RgstrType::layout::upgradeable, "get_shared_lock() unavailable: owning_traits<T>::upgradeable is false");
+                    return OPTR_S_LOCK_{ *this->o_register,
+                                         this->o_pointer };
+                };
+                ///Returns upgradeable-locked read-only container ( upgrade() for exclusive access )
+                inline __attribute__((always_inline))
+                OPTR_U_LOCK_
+                    get_upgrade_lock() const
+                {
+                    static_assert(RgstrType::layout::upgradeable, "get_upgrade_lock() unavailable: owning_traits<T>::upgradeable is false");
+                    return OPTR_U_LOCK_{ *this->o_register,
+                                         this->o_pointer };
+                };
 
                 ///Get owner b_alive status ( false if original owner no longer exists )
                 inline __attribute__((always_inline))
                 bool
                     alive() const
                 {
+                    static_assert(RgstrType::layout::alive_flag, "alive() unavailable: owning_traits<T>::alive_flag is false");
                     if ( this->o_register == nullptr )
                         return false;   //has not been made
 
                     return this->o_register->b_alive;
                 };
 
+                ///Thread holding primary owner ( std::thread::id() if not made or in transfer )
+                inline __attribute__((always_inline))
+                std::thread::id
+                    owner_thread() const
+                {
+                    static_assert(RgstrType::layout::track_owner_thread, "owner_thread() unavailable: owning_traits<T>::track_owner_thread is false");
+                    if ( this->o_register == nullptr )
+                        return std::thread::id();   //has not been made
+
+                    return this->o_register->get_owner_thread();
+                };
+                ///Whether calling thread holds primary owner ( thread-affine fast path check )
+                inline __attribute__((always_inline))
+                bool
+                    owned_by_this_thread() const {
+                    return owner_thread() == std::this_thread::get_id();
+                };
+
                 inline __attribute__((always_inline))
                 size_t
                     use_count() const
@@ -442,6 +1823,26 @@ namespace optr
                     this->o_pointer = oPtr;                 //Assign held ptr
                     this->o_register->operator++();         //increment share_count
 
+                #ifdef OPTR_ENABLE_CENSUS
+                    this->o_register->census_enter(typeid(OPTR_TYPE_).name());
+                #endif
+
+                    check_enable_share_this();  //Check for enable_owning_share_this
+                };
+                ///owning_owner initialize Constructor ( preallocated register )
+                inline __attribute__((always_inline))
+                owning_ptr_base(OPTR_RGSTR_* rPtr,
+                                OPTR_PTR_ oPtr)
+                :
+                    o_register(rPtr),
+                    o_pointer(oPtr)
+                {
+                    this->o_register->operator++();         //increment share_count
+
+                #ifdef OPTR_ENABLE_CENSUS
+                    this->o_register->census_enter(typeid(OPTR_TYPE_).name());   //no-op if allocator entered it
+                #endif
+
                     check_enable_share_this();  //Check for enable_owning_share_this
                 };
 
@@ -452,6 +1853,8 @@ namespace optr
                     check_enable_share_this()
                 {
                     constexpr bool has_sharethis = std::is_base_of<enable_owning_share_this, OPTR_TYPE_>::value;
+                    static_assert(!has_sharethis || owning_traits<OPTR_TYPE_>::share_this,
+                                  "enable_owning_share_this base unavailable: owning_traits<T>::share_this is false");
                     if constexpr ( has_sharethis )
                         this->o_pointer->o_sharethis = this; //set new optr_type shared internal pointer
                 };
@@ -477,9 +1880,7 @@ namespace optr
                     if ( this->o_register == nullptr )
                         return;         //has not been made
 
-                    this->o_register->operator--(); //decrement share_count
-
-                    if ( this->o_register->operator==(0) ) //no more share-holders
+                    if ( this->o_register->drop_share() ) //no more share-holders
                         this->o_register->template destroy<RgstrType, OwnedType>(this->o_register,
                                                                                  this->o_pointer);
                 };
@@ -498,11 +1899,11 @@ namespace optr
     template <typename OwnedType>
     class owning_ptr_v
     :
-        public optr_implem::owning_ptr_base<optr_implem::owning_ptr_register_v, OwnedType>
+        public optr_implem::owning_ptr_base<optr_implem::register_v_of<OwnedType>, OwnedType>
     {
         protected:
             //register_volatile typedef
-            typedef optr_implem::owning_ptr_base<optr_implem::owning_ptr_register_v, OwnedType> OPTR_BASE_;
+            typedef optr_implem::owning_ptr_base<optr_implem::register_v_of<OwnedType>, OwnedType> OPTR_BASE_;
             typedef typename OPTR_BASE_::OPTR_LOCK_ OPTR_LOCK_;
 
             ///Cast owning_ptr_v friend function
@@ -531,7 +1932,11 @@ namespace optr
             owning_ptr_v(const owning_ptr_v<PtrCastType>& c_cp)
             :
                 OPTR_BASE_(c_cp)
-            {};
+            {
+                static_assert(std::is_same<optr_implem::owning_layout_of<OwnedType>,
+                                           optr_implem::owning_layout_of<PtrCastType>>::value,
+                              "owning_traits of cast types select different registers");
+            };
 
             ///Destructor
             virtual ~owning_ptr_v()
@@ -597,7 +2002,8 @@ namespace optr
             ///Destructor
             virtual ~owning_owner_v()
             {
-                this->o_register->b_alive = false;
+                if ( this->o_register != nullptr )
+                    this->o_register->set_alive(false);
             };
 
             ///Assignment Operator
@@ -605,23 +2011,36 @@ namespace optr
             void
                 operator=(const owning_owner_v& ass){
                 OPTR_BASE_::operator=(ass);
-            };
-            ///Assignment Move Operator
-            inline __attribute__((always_inline))
-            void
-                operator=(owning_owner_v&& mass)
-            {
-                this->o_register = mass.o_register;
-                this->o_pointer = mass.o_pointer;
-
-                mass.o_register = nullptr;
-
-                OPTR_BASE_::check_enable_share_this();  //Check for enable_owning_share_this to update this
             };
-            ///NullPtr Assignment Operator
+            ///Assignment Move Operator
+            ///- previously held object loses its owner, moved object stays alive throughout
             inline __attribute__((always_inline))
             void
-                operator=(std::nullptr_t){
+                operator=(owning_owner_v&& mass)
+            {
+                if ( this == &mass )
+                    return;
+
+                if ( this->o_register != nullptr && this->o_register != mass.o_register )
+                    this->o_register->set_alive(false);
+                OPTR_BASE_::operator=(OPTR_BASE_());    //drop previous share
+
+                this->o_register = mass.o_register;
+                this->o_pointer = mass.o_pointer;
+
+                mass.o_register = nullptr;
+                mass.o_pointer = nullptr;
+
+                if ( this->o_register != nullptr )
+                    OPTR_BASE_::check_enable_share_this();  //Check for enable_owning_share_this to update this
+            };
+            ///NullPtr Assignment Operator ( owner gone )
+            inline __attribute__((always_inline))
+            void
+                operator=(std::nullptr_t)
+            {
+                if ( this->o_register != nullptr )
+                    this->o_register->set_alive(false);
                 OPTR_BASE_::operator=(OPTR_BASE_());
             };
 
@@ -631,7 +2050,8 @@ namespace optr
             :
                 owning_ptr_v<OwnedType>(iPtr)
             {
-                this->o_register->b_alive = true;
+                this->o_register->set_alive(true);
+                this->o_register->set_owner_thread(std::this_thread::get_id());
             };
 
             owning_owner_v(const owning_owner_v&) = delete;
@@ -642,17 +2062,19 @@ namespace optr
     template <typename OwnedType>
     class owning_ptr_o
     :
-        public optr_implem::owning_ptr_base<optr_implem::owning_ptr_register_o, OwnedType>
+        public optr_implem::owning_ptr_base<optr_implem::register_o_of<OwnedType>, OwnedType>
     {
         protected:
             //register_owned typedef
-            typedef optr_implem::owning_ptr_base<optr_implem::owning_ptr_register_o, OwnedType> OPTR_BASE_;
+            typedef optr_implem::owning_ptr_base<optr_implem::register_o_of<OwnedType>, OwnedType> OPTR_BASE_;
             typedef typename OPTR_BASE_::OPTR_LOCK_ OPTR_LOCK_;
 
             ///Cast owning_ptr_o friend function
             template <typename PtrCastType, typename OT>
             friend owning_ptr_o<PtrCastType>
                 owning_ptr_cast_o(const owning_ptr_o<OT>& cOPtr);
+            ///Sharer construction from preallocated register blocks
+            friend class optr_implem::owning_ptr_access;
 
         public:
             ///Empty Constructor
@@ -675,7 +2097,11 @@ namespace optr
             owning_ptr_o(const owning_ptr_o<PtrCastType>& c_cp)
             :
                 OPTR_BASE_(c_cp)
-            {};
+            {
+                static_assert(std::is_same<optr_implem::owning_layout_of<OwnedType>,
+                                           optr_implem::owning_layout_of<PtrCastType>>::value,
+                              "owning_traits of cast types select different registers");
+            };
 
             ///Destructor
             virtual ~owning_ptr_o()
@@ -694,6 +2120,42 @@ namespace optr
                 OPTR_BASE_::operator=(OPTR_BASE_());
             };
 
+            ///Post closure fn(OwnedType&) to held object's mailbox ( owning_traits<T>::mailbox )
+            ///- closures for one object run serially in posting order, without taking mutex_optr
+            ///- first poster on an empty mailbox drains it on the calling thread
+            ///- an exception from any closure drained by this call is rethrown after the mailbox is empty
+            ///- dropped without allocating once owner is no longer alive
+            template <typename Fn>
+            inline __attribute__((always_inline))
+            void
+                post(Fn&& fn)
+            {
+                static_assert(optr_implem::register_o_of<OwnedType>::layout::mailbox, "post() unavailable: owning_traits<T>::mailbox is false");
+                if ( this->o_register == nullptr || !this->o_register->is_alive() )
+                    return;     //has not been made / owner gone
+
+                if ( this->o_register->enqueue_post(make_post_task(std::forward<Fn>(fn))) )
+                    this->o_register->drain_posts();
+            };
+            ///Post closure fn(OwnedType&) to held object's mailbox, draining through executor
+            ///- exec is called with a void() callable when this post claims the drainer role
+            template <typename Fn, typename Executor>
+            inline __attribute__((always_inline))
+            void
+                post(Fn&& fn,
+                     Executor&& exec)
+            {
+                static_assert(optr_implem::register_o_of<OwnedType>::layout::mailbox, "post() unavailable: owning_traits<T>::mailbox is false");
+                if ( this->o_register == nullptr || !this->o_register->is_alive() )
+                    return;     //has not been made / owner gone
+
+                if ( this->o_register->enqueue_post(make_post_task(std::forward<Fn>(fn))) )
+                {
+                    owning_ptr_o keep(*this);   //hold register until drained
+                    exec([keep]() mutable { keep.o_register->drain_posts(); });
+                }
+            };
+
         protected:
             ///make_owning_owner_o initial Constructor ( Copy )
             inline __attribute__((always_inline))
@@ -713,6 +2175,13 @@ namespace optr
             :
                 OPTR_BASE_(newOPtr)
             {};
+            ///make_owning_owner_o initial Constructor ( preallocated register )
+            inline __attribute__((always_inline))
+            owning_ptr_o(optr_implem::register_o_of<OwnedType>* rPtr,
+                         OwnedType* newOPtr)
+            :
+                OPTR_BASE_(rPtr, newOPtr)
+            {};
 
         private:
             ///Share Cast Constructor
@@ -723,6 +2192,16 @@ namespace optr
                 OPTR_BASE_(c_cp, iPtr)
             {};
 
+            ///Bind closure to this pointer for mailbox
+            template <typename Fn>
+            inline __attribute__((always_inline))
+            optr_implem::owning_ptr_post_node*
+                make_post_task(Fn&& fn) const
+            {
+                using TASK_ = optr_implem::owning_ptr_post_task<OwnedType, typename std::decay<Fn>::type>;
+                return new TASK_(this->o_pointer, std::forward<Fn>(fn));
+            };
+
     };  // end of owning_ptr_o class
     ///-------------------------------------------------------------------------------------------------------
     ///owning_owner_o class                       --------------------------------------------------------------
@@ -744,6 +2223,10 @@ namespace optr
             template <typename T, typename... Args>
             friend owning_owner_o<T>
                 optr::make_owning_owner_o(Args&&... args);
+            ///Owner construction from preallocated register blocks
+            friend class optr_implem::owning_ptr_access;
+            ///Owner handoff between threads
+            friend class owning_transfer_o<OwnedType>;
 
         public:
             ///Default Constructor
@@ -767,7 +2250,7 @@ namespace optr
             virtual ~owning_owner_o()
             {
                 if ( this->o_register != nullptr )
-                    this->o_register->b_alive = false;
+                    this->o_register->set_alive(false);
             };
 
             ///Assignment Operator
@@ -775,53 +2258,162 @@ namespace optr
             void
                 operator=(const owning_owner_o& ass){
                 OPTR_BASE_::operator=(ass);
-            };
-            ///Assignment Move Operator
-            inline __attribute__((always_inline))
-            void
-                operator=(owning_owner_o&& mass)
-            {
-                this->o_register = mass.o_register;
-                this->o_pointer = mass.o_pointer;
-
-                mass.o_register = nullptr;
-
-                OPTR_BASE_::check_enable_share_this();  //Check for enable_owning_share_this
-            };
+            };
+            ///Assignment Move Operator
+            ///- previously held object loses its owner, moved object stays alive throughout
+            inline __attribute__((always_inline))
+            void
+                operator=(owning_owner_o&& mass)
+            {
+                if ( this == &mass )
+                    return;
 
-            ///NullPtr Assignment Operator
+                if ( this->o_register != nullptr && this->o_register != mass.o_register )
+                    this->o_register->set_alive(false);
+                OPTR_BASE_::operator=(OPTR_BASE_());    //drop previous share
+
+                this->o_register = mass.o_register;
+                this->o_pointer = mass.o_pointer;
+
+                mass.o_register = nullptr;
+                mass.o_pointer = nullptr;
+
+                if ( this->o_register != nullptr )
+                    OPTR_BASE_::check_enable_share_this();  //Check for enable_owning_share_this to update this
+            };
+
+            ///NullPtr Assignment Operator ( owner gone )
             inline __attribute__((always_inline))
             void
-                operator=(std::nullptr_t){
+                operator=(std::nullptr_t)
+            {
+                if ( this->o_register != nullptr )
+                    this->o_register->set_alive(false);
                 OPTR_BASE_::operator=(OPTR_BASE_());
             };
 
+            ///Hand ownership to target thread ( std::thread::id() : whichever thread claims )
+            ///- this owner becomes empty, alive() stays true while the token is queued
+            inline
+            owning_transfer_o<OwnedType>
+                release_to(const std::thread::id target = std::thread::id()){
+                return owning_transfer_o<OwnedType>(std::move(*this), target);
+            };
+
         private:
             ///Copy Constructor
             owning_owner_o(const OwnedType& cp)
             :
                 owning_ptr_o<OwnedType>(cp)
             {
-                this->o_register->b_alive = true;
+                this->o_register->set_alive(true);
+                this->o_register->set_owner_thread(std::this_thread::get_id());
             };
             ///Move Constructor
             owning_owner_o(OwnedType&& mv)
             :
                 owning_ptr_o<OwnedType>(std::move(mv))
             {
-                this->o_register->b_alive = true;
+                this->o_register->set_alive(true);
+                this->o_register->set_owner_thread(std::this_thread::get_id());
+            };
+            ///New Constructor
+            owning_owner_o(OwnedType*& newOPtr)
+            :
+                owning_ptr_o<OwnedType>(newOPtr)
+            {
+                this->o_register->set_alive(true);
+                this->o_register->set_owner_thread(std::this_thread::get_id());
+            };
+            ///Preallocated Register Constructor
+            owning_owner_o(optr_implem::register_o_of<OwnedType>* rPtr,
+                           OwnedType* newOPtr)
+            :
+                owning_ptr_o<OwnedType>(rPtr, newOPtr)
+            {
+                this->o_register->set_alive(true);
+                this->o_register->set_owner_thread(std::this_thread::get_id());
+            };
+
+            /// - deleted
+            owning_owner_o(const owning_owner_o&) = delete;
+    };  // end of owning_owner_o class
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///owning_transfer_o class ( owner in transit between threads )             ------------------------------
+    ///- move-only token, safe to push through any queue; the register records target as owner meanwhile
+    template <typename OwnedType>
+    class owning_transfer_o
+    {
+        friend class owning_owner_o<OwnedType>;
+
+        public:
+            ///Empty Constructor
+            owning_transfer_o()
+            {};
+            ///Move Constructor
+            owning_transfer_o(owning_transfer_o&& mv)
+            :
+                owner(std::move(mv.owner)),
+                target(mv.target)
+            {};
+
+            ///Move Assignment ( a pending owner here is dropped )
+            inline
+            owning_transfer_o&
+                operator=(owning_transfer_o&& mv)
+            {
+                this->owner = std::move(mv.owner);
+                this->target = mv.target;
+                return *this;
+            };
+
+            ///Take ownership on calling thread
+            ///- throws std::logic_error if the token is empty or targeted at another thread
+            inline
+            owning_owner_o<OwnedType>
+                claim()
+            {
+                if ( this->owner.o_register == nullptr )
+                    throw std::logic_error("owning_transfer_o::claim: no owner in transfer");
+                if ( this->target != std::thread::id() && this->target != std::this_thread::get_id() )
+                    throw std::logic_error("owning_transfer_o::claim: claimed by a thread other than target");
+
+                this->owner.o_register->set_owner_thread(std::this_thread::get_id());
+                return std::move(this->owner);
             };
-            ///New Constructor
-            owning_owner_o(OwnedType*& newOPtr)
+
+            ///Thread expected to claim ( std::thread::id() : any )
+            inline
+            std::thread::id
+                target_thread() const {
+                return this->target;
+            };
+            ///Owner pending claim
+            inline
+            explicit operator bool() const {
+                return this->owner.o_register != nullptr;
+            };
+
+        private:
+            ///release_to Constructor
+            owning_transfer_o(owning_owner_o<OwnedType>&& own,
+                              const std::thread::id tgt)
             :
-                owning_ptr_o<OwnedType>(newOPtr)
+                owner(std::move(own)),
+                target(tgt)
             {
-                this->o_register->b_alive = true;
+                if ( this->owner.o_register != nullptr )
+                    this->owner.o_register->set_owner_thread(tgt);
             };
 
+            owning_owner_o<OwnedType> owner;    ///< owner in transit
+            std::thread::id target;             ///< claiming thread
+
             /// - deleted
-            owning_owner_o(const owning_owner_o&) = delete;
-    };  // end of owning_owner_o class
+            owning_transfer_o(const owning_transfer_o&) = delete;
+            owning_transfer_o& operator=(const owning_transfer_o&) = delete;
+    };  // end of owning_transfer_o class
 
     ///-------------------------------------------------------------------------------------------------------
     ///Inherited class to enable sharing owning_ptr from 'this'                     --------------------------
@@ -854,6 +2446,450 @@ namespace optr
             void* o_sharethis = nullptr;    ///< pointer to owning_owner
     };
 
+    ///-------------------------------------------------------------------------------------------------------
+    ///Owning pool statistics snapshot                                          ------------------------------
+    struct owning_pool_stats
+    {
+        size_t hits     = 0;    ///< make calls served from a thread cache
+        size_t misses   = 0;    ///< make calls that allocated a new block
+        size_t recycled = 0;    ///< released blocks returned to a thread cache
+        size_t freed    = 0;    ///< released blocks deleted ( thread cache full or thread exited )
+
+        ///Fraction of make calls served without allocating
+        inline
+        double
+            hit_rate() const
+        {
+            const size_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+        };
+    };
+
+    namespace optr_implem
+    {
+        ///-------------------------------------------------------------------------------------------------------
+        ///BUILD OWNERS AROUND PREALLOCATED REGISTERS                               ------------------------------
+        class owning_ptr_access
+        {
+            public:
+                ///Make owning_owner_o around register + constructed object
+                template <typename OwnedType>
+                static inline __attribute__((always_inline))
+                owning_owner_o<OwnedType>
+                    make_owner_o(register_o_of<OwnedType>* rPtr,
+                                 OwnedType* oPtr)
+                {
+                    return owning_owner_o<OwnedType>(rPtr, oPtr);
+                };
+                ///Make owning_ptr_o ( non-owner ) around register + constructed object
+                template <typename OwnedType>
+                static inline __attribute__((always_inline))
+                owning_ptr_o<OwnedType>
+                    make_ptr_o(register_o_of<OwnedType>* rPtr,
+                               OwnedType* oPtr)
+                {
+                    return owning_ptr_o<OwnedType>(rPtr, oPtr);
+                };
+                ///Register identity of any owning_ptr ( nullptr if not made )
+                template <typename RgstrType, typename OwnedType>
+                static inline __attribute__((always_inline))
+                const RgstrType*
+                    register_of(const owning_ptr_base<RgstrType, OwnedType>& optr){
+                    return optr.o_register;
+                };
+
+                ///Take share on register outside of an owning_ptr
+                static inline __attribute__((always_inline))
+                void
+                    hold(owning_ptr_register* rPtr){
+                    rPtr->operator++();
+                };
+                ///Drop share taken by hold(), releasing block if last ( arena / pool blocks only )
+                static inline __attribute__((always_inline))
+                void
+                    unhold(owning_ptr_register* rPtr)
+                {
+                    if ( rPtr->drop_share() )
+                    {
+                        const bool b_released = rPtr->release_block();
+                        assert(b_released && "unhold() on a register without release hook");
+                        (void)b_released;
+                    }
+                };
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///SINGLE ALLOCATION HOLDING MANY REGISTER+OBJECT BLOCKS                    ------------------------------
+        ///- freed once the creator and every block placed in it have released their reference
+        class owning_ptr_arena
+        {
+            public:
+                ///Allocate arena with room for n_bytes of blocks ( reference held by caller )
+                ///- n_align must be a power of two; throws std::invalid_argument otherwise
+                static inline
+                owning_ptr_arena*
+                    create(size_t n_bytes,
+                           size_t n_align)
+                {
+                    if ( n_align == 0 || ( n_align & ( n_align - 1 ) ) != 0 )
+                        throw std::invalid_argument("owning_ptr_arena: alignment is not a power of two");
+
+                    //header padded to a full alignment unit, so block storage keeps n_align
+                    const size_t align = n_align < header_size() ? header_size() : n_align;
+                    void* mem = ::operator new(align + n_bytes, std::align_val_t(align));
+                    return new (mem) owning_ptr_arena(n_bytes, align);
+                };
+
+                ///Start of block storage ( aligned to create() n_align )
+                inline __attribute__((always_inline))
+                unsigned char*
+                    data(){
+                    return reinterpret_cast<unsigned char*>(this) + this->n_align;
+                };
+                ///Bytes of block storage
+                inline __attribute__((always_inline))
+                size_t
+                    size() const {
+                    return this->n_size;
+                };
+
+                ///Add reference ( one per live block )
+                inline __attribute__((always_inline))
+                void
+                    retain(){
+                    this->ref_count.fetch_add(1, std::memory_order_relaxed);
+                };
+                ///Drop reference, freeing arena when last
+                inline __attribute__((always_inline))
+                void
+                    release()
+                {
+                    if ( this->ref_count.fetch_sub(1, std::memory_order_acq_rel) != 1 )
+                        return;
+
+                    const size_t align = this->n_align;
+                    this->~owning_ptr_arena();
+                    ::operator delete(static_cast<void*>(this), std::align_val_t(align));
+                };
+
+            private:
+                ///Init Constructor
+                owning_ptr_arena(size_t n_bytes,
+                                 size_t align)
+                :
+                    ref_count(1),
+                    n_size(n_bytes),
+                    n_align(align)
+                {};
+
+                ///Minimum header size, keeps block storage cache line aligned
+                static constexpr
+                size_t
+                    header_size(){
+                    return 64;
+                };
+
+                ATM_U_ ref_count;   ///< creator + live blocks
+                size_t n_size;      ///< bytes of block storage
+                size_t n_align;     ///< allocation alignment
+
+                /// - deleted
+                owning_ptr_arena(const owning_ptr_arena&) = delete;
+                owning_ptr_arena(owning_ptr_arena&&) = delete;
+        };
+        static_assert(sizeof(owning_ptr_arena) <= 64, "owning_ptr_arena header exceeds reserved space");
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///REGISTER AND OBJECT STORAGE PLACED INSIDE AN ARENA                       ------------------------------
+        template <typename OwnedType>
+        class owning_ptr_arena_block
+        :
+            public register_o_of<OwnedType>
+        {
+            public:
+                ///Place block at mem, holding a reference on arena ( object not yet constructed )
+                static inline
+                owning_ptr_arena_block*
+                    place(void* mem,
+                          owning_ptr_arena* arena)
+                {
+                    auto blk = new (mem) owning_ptr_arena_block(arena);
+                    arena->retain();
+                #ifdef OPTR_ENABLE_CENSUS
+                    blk->census_enter(typeid(OwnedType).name());
+                #endif
+                    return blk;
+                };
+
+                ///Destructor
+                virtual ~owning_ptr_arena_block()
+                {};
+
+                ///Object storage
+                inline __attribute__((always_inline))
+                void*
+                    storage(){
+                    return this->o_storage;
+                };
+                ///Object constructed in storage
+                inline __attribute__((always_inline))
+                OwnedType*
+                    object(){
+                    return std::launder(reinterpret_cast<OwnedType*>(this->o_storage));
+                };
+
+                ///Undo place() when object construction failed
+                inline
+                void
+                    unplace()
+                {
+                    auto arena = this->o_arena;
+                    this->~owning_ptr_arena_block();
+                    arena->release();
+                };
+
+            private:
+                ///Init Constructor
+                explicit owning_ptr_arena_block(owning_ptr_arena* arena)
+                :
+                    o_arena(arena)
+                {};
+
+                ///owning_ptr_register release hook ( last sharer gone )
+                virtual bool
+                    release_block() override
+                {
+                    this->object()->~OwnedType();
+                    this->unplace();
+                    return true;
+                };
+
+                owning_ptr_arena* const o_arena;                                    ///< arena holding this block
+                alignas(block_storage_align<OwnedType>) unsigned char o_storage[sizeof(OwnedType)];  ///< held object storage
+
+                /// - deleted
+                owning_ptr_arena_block(const owning_ptr_arena_block&) = delete;
+                owning_ptr_arena_block(owning_ptr_arena_block&&) = delete;
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///REGISTER AND OBJECT STORAGE IN ONE ALLOCATION                            ------------------------------
+        template <typename OwnedType>
+        class owning_ptr_pool_block
+        :
+            public register_o_of<OwnedType>
+        {
+            friend class owning_ptr_pool<OwnedType>;
+
+            public:
+                ///Destructor
+                virtual ~owning_ptr_pool_block()
+                {};
+
+                ///owning_ptr_register release hook ( last sharer gone )
+                virtual bool
+                    release_block() override
+                {
+                    owning_ptr_pool<OwnedType>::release(this);
+                    return true;
+                };
+
+                ///Object constructed in storage
+                inline __attribute__((always_inline))
+                OwnedType*
+                    object()
+                {
+                    return std::launder(reinterpret_cast<OwnedType*>(this->o_storage));
+                };
+
+            private:
+                ///Default Constructor
+                owning_ptr_pool_block()
+                {};
+
+                alignas(block_storage_align<OwnedType>) unsigned char o_storage[sizeof(OwnedType)];  ///< held object storage
+                owning_ptr_pool_block* next_free = nullptr;                     ///< thread cache link
+            #ifdef OPTR_ENABLE_NUMA
+                unsigned numa_node = 0;                                         ///< node of allocating thread
+            #endif
+
+                /// - deleted
+                owning_ptr_pool_block(const owning_ptr_pool_block&) = delete;
+                owning_ptr_pool_block(owning_ptr_pool_block&&) = delete;
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///PER-TYPE THREAD-CACHED FREE LIST OF REGISTER+OBJECT BLOCKS               ------------------------------
+        template <typename OwnedType>
+        class owning_ptr_pool
+        {
+            using BLOCK_ = owning_ptr_pool_block<OwnedType>;
+            friend BLOCK_;
+
+            public:
+                ///Construct object in a cached ( or new ) block and make its owner
+                template <typename... Args>
+                static inline __attribute__((always_inline))
+                owning_owner_o<OwnedType>
+                    make(Args&&... args)
+                {
+                    auto blk = acquire();
+                    try
+                    {
+                        new (blk->o_storage) OwnedType(std::forward<Args>(args)...);
+                    }
+                    catch (...)
+                    {
+                        recycle(blk);
+                        throw;
+                    }
+
+                    return owning_ptr_access::make_owner_o<OwnedType>(blk, blk->object());
+                };
+
+                ///Preallocate blocks into calling thread's cache
+                static inline
+                void
+                    reserve(size_t n)
+                {
+                    while ( n-- > 0 )
+                        recycle(new_block());
+                };
+
+                ///Set max blocks kept per thread ( applies to later releases )
+                static inline
+                void
+                    set_thread_capacity(size_t n){
+                    thread_capacity.store(n, std::memory_order_relaxed);
+                };
+
+                ///Current statistics
+                static inline
+                owning_pool_stats
+                    stats()
+                {
+                    owning_pool_stats st;
+                    st.hits     = n_hits.load(std::memory_order_relaxed);
+                    st.misses   = n_misses.load(std::memory_order_relaxed);
+                    st.recycled = n_recycled.load(std::memory_order_relaxed);
+                    st.freed    = n_freed.load(std::memory_order_relaxed);
+                    return st;
+                };
+
+            private:
+                ///Thread cache ( trivially destructible so late releases during thread exit stay valid )
+                struct cache_list
+                {
+                    BLOCK_* head;       ///< most recently released block
+                    size_t n_cached;    ///< blocks in list
+                    bool b_closed;      ///< thread is exiting, release straight to delete
+                };
+                ///Flushes thread cache on thread exit
+                struct cache_guard
+                {
+                    ~cache_guard()
+                    {
+                        tl_cache.b_closed = true;
+                        while ( tl_cache.head != nullptr )
+                        {
+                            auto next = tl_cache.head->next_free;
+                            delete tl_cache.head;
+                            tl_cache.head = next;
+                        }
+                        tl_cache.n_cached = 0;
+                    };
+                };
+
+                ///Allocate fresh block
+                static inline
+                BLOCK_*
+                    new_block()
+                {
+                    auto blk = new BLOCK_;      //placement left to allocator and kernel
+                #ifdef OPTR_ENABLE_NUMA
+                    blk->numa_node = numa_node_of_thread();
+                #endif
+                    return blk;
+                };
+
+                ///Pop block from thread cache or allocate
+                static inline __attribute__((always_inline))
+                BLOCK_*
+                    acquire()
+                {
+                    auto blk = tl_cache.head;
+                    if ( blk == nullptr )
+                    {
+                        n_misses.fetch_add(1, std::memory_order_relaxed);
+                        blk = new_block();
+                    }
+                    else
+                    {
+                        tl_cache.head = blk->next_free;
+                        tl_cache.n_cached--;
+                        n_hits.fetch_add(1, std::memory_order_relaxed);
+                    }
+                #ifdef OPTR_ENABLE_CENSUS
+                    blk->census_enter(typeid(OwnedType).name());
+                #endif
+                    return blk;
+                };
+
+                ///Push empty block to thread cache or delete
+                ///- OPTR_ENABLE_NUMA : blocks allocated on another node than the releasing thread now runs on are
+                ///  deleted rather than cached ( a thread that migrates keeps blocks cached before it moved )
+                static inline __attribute__((always_inline))
+                void
+                    recycle(BLOCK_* blk)
+                {
+                    thread_local cache_guard tl_guard;
+                    (void)tl_guard;
+
+                    if ( tl_cache.b_closed
+                         || tl_cache.n_cached >= thread_capacity.load(std::memory_order_relaxed)
+                    #ifdef OPTR_ENABLE_NUMA
+                         || blk->numa_node != numa_node_of_thread()
+                    #endif
+                       )
+                    {
+                        n_freed.fetch_add(1, std::memory_order_relaxed);
+                        delete blk;
+                        return;
+                    }
+
+                #ifdef OPTR_ENABLE_CENSUS
+                    blk->census_leave();    //cached blocks are not live registers
+                #endif
+                    blk->next_free = tl_cache.head;
+                    tl_cache.head = blk;
+                    tl_cache.n_cached++;
+                    n_recycled.fetch_add(1, std::memory_order_relaxed);
+                };
+
+                ///Destroy object and recycle its block ( BLOCK_::release_block() )
+                static
+                void
+                    release(BLOCK_* blk)
+                {
+                    blk->object()->~OwnedType();
+                    blk->set_alive(false);  //owner may have been nulled rather than destroyed
+                    recycle(blk);
+                };
+
+                static thread_local cache_list tl_cache;    ///< calling thread's free list
+
+                static inline ATM_U_ thread_capacity{4096}; ///< max cached blocks per thread
+                static inline ATM_U_ n_hits{0};
+                static inline ATM_U_ n_misses{0};
+                static inline ATM_U_ n_recycled{0};
+                static inline ATM_U_ n_freed{0};
+        };
+
+        template <typename OwnedType>
+        thread_local typename owning_ptr_pool<OwnedType>::cache_list owning_ptr_pool<OwnedType>::tl_cache{ nullptr, 0, false };
+
+    };  // end of optr_implem namespace
+
     ///-------------------------------------------------------------------------------------------------------
     ///-------------------------------------------------------------------------------------------------------
     /// ---------- ( HELPER FUNCTIONS ) -------- ( HELPER FUNCTIONS ) -------- ( HELPER FUNCTIONS ) ----------
@@ -883,8 +2919,8 @@ namespace optr
     template <typename OwnedType>
      static inline __attribute__((always_inline))
      owning_owner_o<OwnedType>
-        make_owning_owner_o(const OwnedType& cpTp)
-    {
+        make_owning_owner_o(const OwnedType& cpTp)
+    {
         auto newoptr = new OwnedType(cpTp);     //get ptr from register
         return owning_owner_o<OwnedType>(newoptr);
     };
@@ -893,8 +2929,8 @@ namespace optr
     template <typename OwnedType>
     static inline __attribute__((always_inline))
     owning_owner_o<OwnedType>
-        make_owning_owner_o(OwnedType&& mvTp)
-    {
+        make_owning_owner_o(OwnedType&& mvTp)
+    {
         auto newoptr = new OwnedType(std::move(mvTp));
         return owning_owner_o<OwnedType>(newoptr);
      };
@@ -908,6 +2944,304 @@ namespace optr
         return owning_owner_o<OwnedType>(newoptr);
     };
 
+    ///-------------------------------------------------------------------------------------------------------
+    ///Make owning_owner_o from per-type pool                           --------------------------------------
+    ///- register and object share one recycled block, reused by the next make on this thread
+    template <typename OwnedType, typename... Args>
+    static inline __attribute__((always_inline))
+    owning_owner_o<OwnedType>
+        make_pooled_owning_owner_o(Args&&... args){
+        return optr_implem::owning_ptr_pool<OwnedType>::make(std::forward<Args>(args)...);
+    };
+    ///Preallocate pool blocks for OwnedType into calling thread's cache
+    template <typename OwnedType>
+    static inline
+    void
+        owning_pool_reserve(size_t n){
+        optr_implem::owning_ptr_pool<OwnedType>::reserve(n);
+    };
+    ///Get pool statistics for OwnedType
+    template <typename OwnedType>
+    static inline
+    owning_pool_stats
+        get_owning_pool_stats(){
+        return optr_implem::owning_ptr_pool<OwnedType>::stats();
+    };
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Make n owning_owner_o in one contiguous slab                     --------------------------------------
+    ///- every object is constructed from the same args, in slab order
+    ///- slab is freed once the last member's share_count reaches zero
+    template <typename OwnedType, typename... Args>
+    static inline
+    std::vector<owning_owner_o<OwnedType>>
+        make_owning_owners_o(size_t n,
+                             const Args&... args)
+    {
+        using BLOCK_ = optr_implem::owning_ptr_arena_block<OwnedType>;
+
+        std::vector<owning_owner_o<OwnedType>> owners;
+        if ( n == 0 )
+            return owners;
+        owners.reserve(n);
+
+        auto arena = optr_implem::owning_ptr_arena::create(n * sizeof(BLOCK_), alignof(BLOCK_));
+        try
+        {
+            for ( size_t i = 0; i < n; i++ )
+            {
+                auto blk = BLOCK_::place(arena->data() + i * sizeof(BLOCK_), arena);
+                try
+                {
+                    new (blk->storage()) OwnedType(args...);
+                }
+                catch (...)
+                {
+                    blk->unplace();
+                    throw;
+                }
+                owners.push_back(optr_implem::owning_ptr_access::make_owner_o<OwnedType>(blk, blk->object()));
+            }
+        }
+        catch (...)
+        {
+            owners.clear();     //members made so far release their blocks
+            arena->release();
+            throw;
+        }
+
+        arena->release();       //slab now held by its members only
+        return owners;
+    };
+
+#ifdef OPTR_LOCK_ORDER_CHECK
+    ///-------------------------------------------------------------------------------------------------------
+    ///Replace lock-order inversion report ( cycle of lock classes, first == last )     ----------------------
+    static inline
+    void
+        set_lock_order_report(std::function<void(const std::vector<std::string>&)> fn){
+        optr_implem::owning_lock_order::set_report(std::move(fn));
+    };
+#endif
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Census of live registers                                         --------------------------------------
+    struct owning_census_entry
+    {
+        const void* register_id = nullptr;         ///< register identity
+        const char* type_name   = nullptr;         ///< mangled held type name ( nullptr if never made )
+        size_t share_count      = 0;               ///< current share-holders
+        bool b_alive            = false;           ///< owner still alive
+        double age_seconds      = 0.0;             ///< time since register was made
+
+        ///Owner gone while sharers keep object alive
+        inline
+        bool
+            zombie() const {
+            return !b_alive && share_count > 0;
+        };
+    };
+
+    ///Whether census is compiled in ( OPTR_ENABLE_CENSUS )
+#ifdef OPTR_ENABLE_CENSUS
+    constexpr bool census_enabled = true;
+#else
+    constexpr bool census_enabled = false;
+#endif
+
+    ///Snapshot every live register ( empty unless OPTR_ENABLE_CENSUS )
+    static inline
+    std::vector<owning_census_entry>
+        census()
+    {
+        std::vector<owning_census_entry> entries;
+    #ifdef OPTR_ENABLE_CENSUS
+        const auto now = std::chrono::steady_clock::now();
+        optr_implem::owning_ptr_census::for_each([&](const optr_implem::owning_ptr_register& rgstr,
+                                                     size_t n_share)
+        {
+            owning_census_entry ent;
+            ent.register_id = &rgstr;
+            ent.type_name   = rgstr.census_type;
+            ent.share_count = n_share;
+            ent.b_alive     = rgstr.census_alive();
+            ent.age_seconds = std::chrono::duration<double>(now - rgstr.census_birth).count();
+            entries.push_back(ent);
+        });
+    #endif
+        return entries;
+    };
+
+#ifdef OPTR_ENABLE_CENSUS
+    ///Write census as one line per register, optionally only owner-dead-but-shared ones
+    static inline
+    void
+        census_dump(std::ostream& os,
+                    bool b_zombies_only = false)
+    {
+        const auto entries = census();
+
+        size_t n_zombies = 0;
+        for ( const auto& ent : entries )
+        {
+            if ( ent.zombie() )
+                n_zombies++;
+            else if ( b_zombies_only )
+                continue;
+
+            std::string name = "<unmade>";
+            if ( ent.type_name != nullptr )
+            {
+                int status = 0;
+                char* dmg = abi::__cxa_demangle(ent.type_name, nullptr, nullptr, &status);
+                name = ( status == 0 && dmg != nullptr ) ? dmg : ent.type_name;
+                std::free(dmg);
+            }
+
+            os << ent.register_id
+               << ( ent.zombie() ? " ZOMBIE " : ent.b_alive ? " alive  " : " dead   " )
+               << "shares=" << ent.share_count
+               << " age=" << ent.age_seconds << "s "
+               << name << "\n";
+        }
+        os << "census: " << entries.size() << " live registers, " << n_zombies << " owner-dead-but-shared\n";
+    };
+#endif
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Merged latency distribution of one metric                        --------------------------------------
+    struct owning_latency_histogram
+    {
+        std::vector<uint64_t> counts;   ///< samples per bucket ( bucket_lower() .. bucket_upper() ns )
+        uint64_t total = 0;             ///< samples in all buckets
+
+        ///Bucket bounds in ns
+        static inline
+        uint64_t
+            bucket_lower(const size_t idx){
+            return optr_implem::latency_bucket_lower(idx);
+        };
+        static inline
+        uint64_t
+            bucket_upper(const size_t idx){
+            return optr_implem::latency_bucket_upper(idx);
+        };
+
+        ///Upper bound of bucket holding quantile q ( 0..1 ), 0 if empty
+        inline
+        uint64_t
+            percentile(const double q) const
+        {
+            if ( this->total == 0 )
+                return 0;
+
+            const uint64_t rank = q <= 0.0 ? 1 : uint64_t( q * double(this->total) + 0.5 );
+            uint64_t seen = 0;
+            for ( size_t b = 0; b < this->counts.size(); b++ )
+            {
+                seen += this->counts[b];
+                if ( seen >= rank && this->counts[b] > 0 )
+                    return bucket_upper(b);
+            }
+            return max();
+        };
+        ///Upper bound of highest non-empty bucket
+        inline
+        uint64_t
+            max() const
+        {
+            for ( size_t b = this->counts.size(); b-- > 0; )
+                if ( this->counts[b] > 0 )
+                    return bucket_upper(b);
+            return 0;
+        };
+    };
+
+    ///Whether latency histograms are compiled in ( OPTR_ENABLE_LATENCY_HISTOGRAM )
+#ifdef OPTR_ENABLE_LATENCY_HISTOGRAM
+    constexpr bool latency_histogram_enabled = true;
+#else
+    constexpr bool latency_histogram_enabled = false;
+#endif
+
+    ///Metric name as used in dumps
+    static inline
+    const char*
+        latency_metric_name(const owning_latency_metric metric){
+        return metric == owning_latency_metric::lock_wait ? "lock_wait" : "destroy";
+    };
+
+    ///Merge every thread's samples of metric ( empty unless OPTR_ENABLE_LATENCY_HISTOGRAM )
+    static inline
+    owning_latency_histogram
+        latency_histogram(const owning_latency_metric metric)
+    {
+        owning_latency_histogram hist;
+    #ifdef OPTR_ENABLE_LATENCY_HISTOGRAM
+        hist.counts.resize(optr_implem::LAT_BUCKETS_);
+        optr_implem::owning_latency::collect(metric, hist.counts.data());
+        for ( auto cnt : hist.counts )
+            hist.total += cnt;
+    #else
+        (void)metric;
+    #endif
+        return hist;
+    };
+
+#ifdef OPTR_ENABLE_LATENCY_HISTOGRAM
+    ///Call fn(const char* metric, uint64_t lower_ns, uint64_t upper_ns, uint64_t count) for every non-empty bucket
+    template <typename Fn>
+    static inline
+    void
+        latency_export(Fn&& fn)
+    {
+        for ( auto metric : { owning_latency_metric::lock_wait, owning_latency_metric::destroy } )
+        {
+            const auto hist = latency_histogram(metric);
+            for ( size_t b = 0; b < hist.counts.size(); b++ )
+                if ( hist.counts[b] > 0 )
+                    fn(latency_metric_name(metric), hist.bucket_lower(b), hist.bucket_upper(b), hist.counts[b]);
+        }
+    };
+
+    ///Write non-empty buckets as CSV ( metric,lower_ns,upper_ns,count )
+    static inline
+    void
+        latency_dump_csv(std::ostream& os)
+    {
+        os << "metric,lower_ns,upper_ns,count\n";
+        latency_export([&os](const char* metric, uint64_t lower, uint64_t upper, uint64_t cnt)
+        {
+            os << metric << "," << lower << "," << upper << "," << cnt << "\n";
+        });
+    };
+
+    ///Write one summary line per metric
+    static inline
+    void
+        latency_dump(std::ostream& os)
+    {
+        for ( auto metric : { owning_latency_metric::lock_wait, owning_latency_metric::destroy } )
+        {
+            const auto hist = latency_histogram(metric);
+            os << latency_metric_name(metric)
+               << ": n=" << hist.total
+               << " p50=" << hist.percentile(0.50) << "ns"
+               << " p90=" << hist.percentile(0.90) << "ns"
+               << " p99=" << hist.percentile(0.99) << "ns"
+               << " p99.9=" << hist.percentile(0.999) << "ns"
+               << " max=" << hist.max() << "ns\n";
+        }
+    };
+
+    ///Discard recorded samples
+    static inline
+    void
+        latency_reset(){
+        optr_implem::owning_latency::reset();
+    };
+#endif
+
     ///-------------------------------------------------------------------------------------------------------
     ///Cast owning_ptr_o                                    --------------------------------------------------
     template <typename PtrCastType, typename OwnedType>
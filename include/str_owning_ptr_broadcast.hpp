@@ -0,0 +1,324 @@
+#ifndef STR_LIFETIME_PTR_BROADCAST_HPP
+#define STR_LIFETIME_PTR_BROADCAST_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <str_owning_ptr.hpp>
+
+///-------------------------------------------------------------------------------------------------------
+/// Read-copy-update list of owning_ptr_o handles for fan-out.
+///
+/// Readers take no lock and touch no share_count: they mark one striped reader counter and iterate the
+/// current version in place. Writers serialize on a mutex, copy the current version with their change
+/// applied ( dropping entries whose owner is no longer alive ), publish it, and retire the old version.
+///
+/// Reader counters are split by epoch parity. A write moves the epoch on whenever no reader is left under
+/// the parity it is about to reuse, and a version retired at epoch E is freed once the epoch reaches E + 2.
+/// New readers always count under the current parity, so steady read traffic can't hold back reclamation;
+/// only a read_guard kept open across writes delays the versions retired since it was taken.
+///-------------------------------------------------------------------------------------------------------
+
+namespace optr
+{
+    namespace optr_implem
+    {
+        constexpr size_t BCAST_STRIPES_ = 16;   ///< reader counter stripes ( one cache line each )
+
+        ///Reader counters ( one per epoch parity ) on their own cache line
+        struct alignas(64) owning_broadcast_stripe
+        {
+            std::atomic<size_t> readers[2] = { {0}, {0} };
+        };
+
+        ///Stripe picked once per thread, round robin over threads
+        inline
+        size_t
+            broadcast_stripe_index()
+        {
+            static std::atomic<size_t> next_stripe{0};
+            thread_local const size_t idx = next_stripe.fetch_add(1, std::memory_order_relaxed) % BCAST_STRIPES_;
+            return idx;
+        };
+    };  // end of optr_implem namespace
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Copy-on-write list of owning_ptr_o with lock-free readers                    --------------------------
+    template <typename OwnedType>
+    class owning_broadcast_list
+    {
+        using OPTR_ITEM_ = owning_ptr_o<OwnedType>;         ///< held handle
+        using OPTR_VEC_  = std::vector<OPTR_ITEM_>;         ///< one published version
+
+        public:
+            ///-------------------------------------------------------------------------------------------------------
+            ///Stable view of one version, valid until destroyed                        --------------------------
+            class read_guard
+            {
+                public:
+                    ///Move Constructor
+                    read_guard(read_guard&& mv)
+                    :
+                        readers(mv.readers),
+                        version(mv.version)
+                    {
+                        mv.readers = nullptr;
+                    };
+                    ///Destructor ( leave read side )
+                    ~read_guard()
+                    {
+                        if ( this->readers != nullptr )
+                            this->readers->fetch_sub(1, std::memory_order_release);
+                    };
+
+                    ///Iteration
+                    inline __attribute__((always_inline))
+                    const OPTR_ITEM_*
+                        begin() const {
+                        return this->version->data();
+                    };
+                    inline __attribute__((always_inline))
+                    const OPTR_ITEM_*
+                        end() const {
+                        return this->version->data() + this->version->size();
+                    };
+                    inline __attribute__((always_inline))
+                    size_t
+                        size() const {
+                        return this->version->size();
+                    };
+                    inline __attribute__((always_inline))
+                    const OPTR_ITEM_&
+                        operator[](size_t idx) const {
+                        return (*this->version)[idx];
+                    };
+
+                private:
+                    friend class owning_broadcast_list;
+
+                    ///Constructor ( enter read side under current epoch parity )
+                    read_guard(optr_implem::owning_broadcast_stripe& strp,
+                               const std::atomic<uint64_t>& epoch,
+                               const std::atomic<OPTR_VEC_*>& current)
+                    :
+                        readers(&strp.readers[epoch.load(std::memory_order_seq_cst) & 1])
+                    {
+                        this->readers->fetch_add(1, std::memory_order_seq_cst);
+                        this->version = current.load(std::memory_order_seq_cst);
+                    };
+
+                    std::atomic<size_t>* readers;   ///< counter held ( nullptr : moved from )
+                    const OPTR_VEC_* version;       ///< version being read
+
+                    /// - deleted
+                    read_guard(const read_guard&) = delete;
+                    read_guard& operator=(const read_guard&) = delete;
+            };
+
+            ///Empty Constructor
+            owning_broadcast_list()
+            :
+                current(new OPTR_VEC_())
+            {};
+            ///Destructor ( no readers may remain )
+            ~owning_broadcast_list()
+            {
+                for ( const auto& rtrd : this->retired )
+                    delete rtrd.version;
+                delete this->current.load(std::memory_order_relaxed);
+            };
+
+            ///Enter read side and return current version
+            inline __attribute__((always_inline))
+            read_guard
+                read() const {
+                return read_guard(this->stripes[optr_implem::broadcast_stripe_index()], this->epoch, this->current);
+            };
+            ///Call fn(const owning_ptr_o<OwnedType>&) for every entry of current version
+            template <typename Fn>
+            inline
+            void
+                for_each(Fn&& fn) const
+            {
+                auto rd = read();
+                for ( const auto& item : rd )
+                    fn(item);
+            };
+
+            ///Add entry ( ignored if not made )
+            inline
+            void
+                add(const OPTR_ITEM_& item)
+            {
+                if ( item.get() == nullptr )
+                    return;     //has not been made
+
+                update([&item](OPTR_VEC_& vec){ vec.push_back(item); });
+            };
+            ///Remove every entry sharing item's register
+            inline
+            void
+                remove(const OPTR_ITEM_& item){
+                update([&item](OPTR_VEC_& vec){ erase_if(vec, [&item](const OPTR_ITEM_& cur){ return cur == item; }); });
+            };
+            ///Remove all entries
+            inline
+            void
+                clear(){
+                update([](OPTR_VEC_& vec){ vec.clear(); });
+            };
+            ///Publish a version without dead entries ( writes already prune )
+            inline
+            void
+                prune(){
+                update([](OPTR_VEC_&){});
+            };
+            ///Apply fn(std::vector<owning_ptr_o<OwnedType>>&) to a copy and publish it
+            template <typename Fn>
+            inline
+            void
+                update(Fn&& fn)
+            {
+                std::lock_guard<std::mutex> lck(this->write_mtx);
+
+                auto vrsn = new OPTR_VEC_(*this->current.load(std::memory_order_relaxed));
+                prune_dead(*vrsn);
+                fn(*vrsn);
+
+                const uint64_t epch = this->epoch.load(std::memory_order_relaxed);
+                this->retired.push_back({ this->current.exchange(vrsn, std::memory_order_seq_cst), epch });
+                reclaim();
+            };
+
+            ///Wait until no reader can still see a retired version, then free them
+            ///- must not be called while this thread holds a read_guard of this list
+            inline
+            void
+                synchronize()
+            {
+                std::lock_guard<std::mutex> lck(this->write_mtx);
+
+                for ( int i = 0; i < 2; ++i )
+                {
+                    while ( !try_advance() )
+                        std::this_thread::yield();
+                }
+                free_retired();
+            };
+
+            ///Versions retired but not yet freed
+            inline
+            size_t
+                retired_count()
+            {
+                std::lock_guard<std::mutex> lck(this->write_mtx);
+                return this->retired.size();
+            };
+
+            ///Entries in current version ( may change as soon as it returns )
+            inline
+            size_t
+                size() const {
+                return read().size();
+            };
+
+        private:
+            ///Drop entries whose owner is no longer alive
+            static inline
+            void
+                prune_dead(OPTR_VEC_& vec)
+            {
+                if constexpr ( owning_traits<OwnedType>::alive_flag )
+                    erase_if(vec, [](const OPTR_ITEM_& cur){ return !cur.alive(); });
+            };
+            template <typename Pred>
+            static inline
+            void
+                erase_if(OPTR_VEC_& vec,
+                         Pred pred)
+            {
+                size_t keep = 0;
+                for ( size_t i = 0; i < vec.size(); ++i )
+                    if ( !pred(vec[i]) )
+                    {
+                        if ( keep != i )
+                            vec[keep] = vec[i];
+                        ++keep;
+                    }
+                while ( vec.size() > keep )
+                    vec.pop_back();
+            };
+
+            ///Version replaced while epoch was retire_epoch
+            struct retired_version
+            {
+                OPTR_VEC_* version;
+                uint64_t retire_epoch;
+            };
+
+            ///Move epoch on if no reader is left under the parity it would reuse ( write_mtx held )
+            ///- a reader that loaded the old epoch but counts after this check loads current after the flip,
+            ///  so it only sees versions published before the new epoch began
+            inline
+            bool
+                try_advance()
+            {
+                const uint64_t epch = this->epoch.load(std::memory_order_relaxed);
+                const size_t parity = ( epch + 1 ) & 1;
+                for ( const auto& strp : this->stripes )
+                    if ( strp.readers[parity].load(std::memory_order_seq_cst) != 0 )
+                        return false;
+
+                this->epoch.store(epch + 1, std::memory_order_seq_cst);
+                return true;
+            };
+
+            ///Advance epoch where possible and free versions no reader can hold ( write_mtx held )
+            ///- a reader of a version retired at E counted under an epoch <= E, and both parities
+            ///  have drained once since then by the time epoch reaches E + 2
+            inline
+            void
+                reclaim()
+            {
+                for ( int i = 0; i < 2 && try_advance(); ++i )
+                    ;
+
+                const uint64_t epch = this->epoch.load(std::memory_order_relaxed);
+                size_t keep = 0;
+                for ( size_t i = 0; i < this->retired.size(); ++i )
+                {
+                    if ( this->retired[i].retire_epoch + 2 <= epch )
+                        delete this->retired[i].version;
+                    else
+                        this->retired[keep++] = this->retired[i];
+                }
+                this->retired.resize(keep);
+            };
+            inline
+            void
+                free_retired()
+            {
+                for ( const auto& rtrd : this->retired )
+                    delete rtrd.version;
+                this->retired.clear();
+            };
+
+            std::atomic<OPTR_VEC_*> current;                                            ///< published version
+            std::atomic<uint64_t> epoch{0};                                             ///< reader counter parity selector
+            mutable optr_implem::owning_broadcast_stripe stripes[optr_implem::BCAST_STRIPES_];  ///< reader counters
+            std::mutex write_mtx;                                                       ///< serializes writers
+            std::vector<retired_version> retired;                                       ///< versions awaiting grace
+
+            /// - deleted
+            owning_broadcast_list(const owning_broadcast_list&) = delete;
+            owning_broadcast_list& operator=(const owning_broadcast_list&) = delete;
+    };  // end of owning_broadcast_list class
+
+};  // end of optr namespace
+
+#endif // STR_LIFETIME_PTR_BROADCAST_HPP
@@ -0,0 +1,709 @@
+#ifndef STR_LIFETIME_PTR_SHM_HPP
+#define STR_LIFETIME_PTR_SHM_HPP
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+///-------------------------------------------------------------------------------------------------------
+/// Cross-process owning pointers over a POSIX shared-memory segment.
+///
+/// Registers and objects are placed in the segment and referred to by offset, so every process mapping
+/// the segment sees the same share count, owner-alive flag and process-shared mutex. Held types must be
+/// trivially copyable ( no process-local pointers, destructor never needs to run ). A process that dies
+/// while holding handles leaks their shares; a process that dies holding get_lock() is recovered through
+/// the robust mutex on the next lock.
+///
+/// Attaching never revives a released block: a share is only taken while share_count is non-zero, and a
+/// name resolves only to the allocation it was published for ( freeing a block clears its names, and each
+/// reuse of a block bumps its generation ).
+///-------------------------------------------------------------------------------------------------------
+
+namespace optr
+{
+    class owning_shm_segment;
+    template <typename OwnedType>
+    class owning_shm_ptr;
+    template <typename OwnedType>
+    class owning_shm_owner;
+
+    namespace optr_implem
+    {
+        ///Using aliases
+        using ATM_U64_ = std::atomic<uint64_t>;
+        using ATM_U32_ = std::atomic<uint32_t>;
+
+        static_assert(ATM_U64_::is_always_lock_free && ATM_U32_::is_always_lock_free,
+                      "shared memory owning_ptr requires address-free lock-free atomics");
+
+        constexpr uint32_t SHM_MAGIC_     = 0x4D53504F;  ///< "OPSM"
+        constexpr size_t   SHM_NAME_LEN_  = 48;          ///< published name length ( with terminator )
+        constexpr size_t   SHM_N_NAMES_   = 64;          ///< published name slots
+        constexpr uint64_t SHM_ALIGN_     = 64;          ///< block alignment
+
+        ///Round n up to block alignment
+        inline constexpr
+        uint64_t
+            shm_align_up(uint64_t n){
+            return ( n + SHM_ALIGN_ - 1 ) / SHM_ALIGN_ * SHM_ALIGN_;
+        };
+
+        ///Initialize process-shared robust mutex in place
+        inline
+        void
+            shm_mutex_init(pthread_mutex_t* mtx)
+        {
+            pthread_mutexattr_t attr;
+            pthread_mutexattr_init(&attr);
+            pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+            pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+            const int err = pthread_mutex_init(mtx, &attr);
+            pthread_mutexattr_destroy(&attr);
+            if ( err != 0 )
+                throw std::system_error(err, std::generic_category(), "owning_shm: pthread_mutex_init");
+        };
+        ///Lock process-shared robust mutex, taking over from a dead holder
+        inline
+        void
+            shm_mutex_lock(pthread_mutex_t* mtx)
+        {
+            const int err = pthread_mutex_lock(mtx);
+            if ( err == EOWNERDEAD )
+                pthread_mutex_consistent(mtx);  //previous holder died, protected state is plain data
+            else if ( err != 0 )
+                throw std::system_error(err, std::generic_category(), "owning_shm: pthread_mutex_lock");
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///REGISTER PLACED IN SHARED MEMORY ( OBJECT FOLLOWS AT SHM_ALIGN_ )        ------------------------------
+        struct owning_shm_register
+        {
+            ATM_U64_ share_count;       ///< share-holders across all processes ( 0 : free or being freed )
+            ATM_U64_ generation;        ///< bumped on every allocation of this block
+            ATM_U32_ b_alive;           ///< primary owner still alive ( any process )
+            uint32_t type_size;         ///< sizeof held type ( attach type check )
+            uint64_t block_size;        ///< bytes of whole block ( register + object )
+            uint64_t next_free;         ///< free list link ( offset, 0 : none )
+            pthread_mutex_t mutex_optr; ///< process-shared access mutex lock
+        };
+
+        ///Published name slot
+        struct owning_shm_name
+        {
+            char name[SHM_NAME_LEN_];   ///< empty : unused
+            ATM_U64_ offset;            ///< register offset ( 0 : unpublished )
+            uint64_t generation;        ///< register generation when published ( alloc_mutex )
+        };
+
+        ///Take a share unless the last one is already gone ( never revives a released block )
+        inline
+        bool
+            shm_try_share(owning_shm_register* rgstr)
+        {
+            uint64_t n_share = rgstr->share_count.load(std::memory_order_relaxed);
+            do
+            {
+                if ( n_share == 0 )
+                    return false;
+            } while ( !rgstr->share_count.compare_exchange_weak(n_share, n_share + 1,
+                                                                std::memory_order_acquire,
+                                                                std::memory_order_relaxed) );
+            return true;
+        };
+
+        ///-------------------------------------------------------------------------------------------------------
+        ///SEGMENT HEADER AT OFFSET 0                                               ------------------------------
+        struct owning_shm_header
+        {
+            ATM_U32_ magic;             ///< SHM_MAGIC_ once header is initialized ( release store / acquire load )
+            uint32_t header_size;
+            uint64_t size;              ///< mapped bytes
+            uint64_t bump;              ///< next never-used offset ( alloc_mutex )
+            uint64_t free_head;         ///< freed blocks ( alloc_mutex )
+            pthread_mutex_t alloc_mutex;///< guards allocation and name table writes
+            owning_shm_name names[SHM_N_NAMES_];
+        };
+    };  // end of optr_implem namespace
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///POSIX shared-memory segment mapped into this process                         --------------------------
+    class owning_shm_segment
+    {
+        template <typename OwnedType>
+        friend class owning_shm_ptr;
+        template <typename OwnedType>
+        friend class owning_shm_owner;
+        template <typename OwnedType, typename... Args>
+        friend owning_shm_owner<OwnedType>
+            make_owning_shm_owner(owning_shm_segment& seg,
+                                  Args&&... args);
+
+        public:
+            ///Create ( or replace ) segment of n_bytes
+            static inline
+            owning_shm_segment
+                create(const std::string& name,
+                       size_t n_bytes)
+            {
+                ::shm_unlink(name.c_str());
+                const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+                if ( fd < 0 )
+                    throw std::system_error(errno, std::generic_category(), "owning_shm_segment: shm_open");
+                if ( ::ftruncate(fd, static_cast<off_t>(n_bytes)) != 0 )
+                {
+                    const int err = errno;
+                    ::close(fd);
+                    throw std::system_error(err, std::generic_category(), "owning_shm_segment: ftruncate");
+                }
+
+                owning_shm_segment seg(fd, n_bytes);
+
+                auto hdr = new (seg.base) optr_implem::owning_shm_header;
+                hdr->header_size = sizeof(optr_implem::owning_shm_header);
+                hdr->size        = n_bytes;
+                hdr->bump        = optr_implem::shm_align_up(sizeof(optr_implem::owning_shm_header));
+                hdr->free_head   = 0;
+                for ( auto& slot : hdr->names )
+                {
+                    slot.name[0] = '\0';
+                    slot.offset.store(0, std::memory_order_relaxed);
+                    slot.generation = 0;
+                }
+                optr_implem::shm_mutex_init(&hdr->alloc_mutex);
+
+                hdr->magic.store(optr_implem::SHM_MAGIC_, std::memory_order_release);   //publish initialized header
+                return seg;
+            };
+            ///Map existing segment
+            static inline
+            owning_shm_segment
+                open(const std::string& name)
+            {
+                const int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+                if ( fd < 0 )
+                    throw std::system_error(errno, std::generic_category(), "owning_shm_segment: shm_open");
+
+                struct stat st;
+                if ( ::fstat(fd, &st) != 0 )
+                {
+                    const int err = errno;
+                    ::close(fd);
+                    throw std::system_error(err, std::generic_category(), "owning_shm_segment: fstat");
+                }
+
+                owning_shm_segment seg(fd, static_cast<size_t>(st.st_size));
+                if ( seg.size < sizeof(optr_implem::owning_shm_header)
+                     || seg.header()->magic.load(std::memory_order_acquire) != optr_implem::SHM_MAGIC_
+                     || seg.header()->header_size != sizeof(optr_implem::owning_shm_header) )
+                    throw std::runtime_error("owning_shm_segment: not an owning_ptr segment");
+                return seg;
+            };
+            ///Remove segment name ( mappings stay valid )
+            static inline
+            void
+                unlink(const std::string& name){
+                ::shm_unlink(name.c_str());
+            };
+
+            ///Move Constructor
+            owning_shm_segment(owning_shm_segment&& mv)
+            :
+                base(mv.base),
+                size(mv.size)
+            {
+                mv.base = nullptr;
+            };
+            ///Destructor ( unmap; handles into this segment must be gone )
+            ~owning_shm_segment()
+            {
+                if ( this->base != nullptr )
+                    ::munmap(this->base, this->size);
+            };
+
+            ///Publish register offset under name for other processes ( cleared when the object is freed )
+            template <typename HandleType>
+            inline
+            void
+                publish(const std::string& name,
+                        const HandleType& optr)
+            {
+                if ( name.size() >= optr_implem::SHM_NAME_LEN_ )
+                    throw std::length_error("owning_shm_segment: published name too long");
+
+                auto hdr = header();
+                optr_implem::shm_mutex_lock(&hdr->alloc_mutex);
+                optr_implem::owning_shm_name* slot = nullptr;
+                for ( auto& nm : hdr->names )
+                {
+                    if ( std::strncmp(nm.name, name.c_str(), optr_implem::SHM_NAME_LEN_) == 0 )
+                    {
+                        slot = &nm;
+                        break;
+                    }
+                    if ( slot == nullptr && nm.name[0] == '\0' )
+                        slot = &nm;
+                }
+                if ( slot != nullptr )
+                {
+                    std::memcpy(slot->name, name.c_str(), name.size() + 1);  //length checked above
+                    slot->generation = optr.offset() == 0 ? 0 : register_at(optr.offset())->generation.load(std::memory_order_relaxed);
+                    slot->offset.store(optr.offset(), std::memory_order_release);
+                }
+                pthread_mutex_unlock(&hdr->alloc_mutex);
+
+                if ( slot == nullptr )
+                    throw std::length_error("owning_shm_segment: published name table full");
+            };
+            ///Offset published under name ( 0 if none )
+            inline
+            uint64_t
+                find(const std::string& name) const
+            {
+                uint64_t generation = 0;
+                return find(name, generation);
+            };
+
+            ///Share object at register offset ( from publish/find or owning_shm_ptr::offset )
+            ///- empty if the object has already been released; the caller must know the block was not
+            ///  freed and reused since the offset was taken ( attach by name checks this )
+            template <typename OwnedType>
+            inline
+            owning_shm_ptr<OwnedType>
+                attach(uint64_t offset)
+            {
+                owning_shm_ptr<OwnedType> optr;
+                if ( offset == 0 )
+                    return optr;
+                if ( offset < optr_implem::shm_align_up(sizeof(optr_implem::owning_shm_header))
+                     || offset % optr_implem::SHM_ALIGN_ != 0
+                     || offset + sizeof(optr_implem::owning_shm_register) > this->size )
+                    throw std::runtime_error("owning_shm_segment: attach to invalid register");
+
+                if ( !optr_implem::shm_try_share(register_at(offset)) )
+                    return optr;    //released
+                optr.o_segment = this;
+                optr.o_offset  = offset;    //share taken above
+
+                if ( register_at(offset)->type_size != sizeof(OwnedType) )
+                    throw std::runtime_error("owning_shm_segment: attach to invalid register");
+                return optr;
+            };
+            ///Share object published under name ( empty if unpublished or released )
+            template <typename OwnedType>
+            inline
+            owning_shm_ptr<OwnedType>
+                attach(const std::string& name)
+            {
+                uint64_t generation = 0;
+                auto optr = attach<OwnedType>(find(name, generation));
+
+                //share held, so block can't be reused from here on : check it is still the published one
+                if ( optr.offset() != 0
+                     && register_at(optr.offset())->generation.load(std::memory_order_acquire) != generation )
+                    return owning_shm_ptr<OwnedType>();
+                return optr;
+            };
+
+        private:
+            ///Map fd ( closed after mapping )
+            owning_shm_segment(int fd,
+                               size_t n_bytes)
+            :
+                size(n_bytes)
+            {
+                void* mem = ::mmap(nullptr, n_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                const int err = errno;
+                ::close(fd);
+                if ( mem == MAP_FAILED )
+                    throw std::system_error(err, std::generic_category(), "owning_shm_segment: mmap");
+                this->base = static_cast<unsigned char*>(mem);
+            };
+
+            ///Offset and generation published under name ( 0 if none )
+            inline
+            uint64_t
+                find(const std::string& name,
+                     uint64_t& generation) const
+            {
+                auto hdr = header();
+                uint64_t offset = 0;
+                optr_implem::shm_mutex_lock(&hdr->alloc_mutex);
+                for ( const auto& nm : hdr->names )
+                    if ( std::strncmp(nm.name, name.c_str(), optr_implem::SHM_NAME_LEN_) == 0 )
+                    {
+                        offset     = nm.offset.load(std::memory_order_relaxed);
+                        generation = nm.generation;
+                        break;
+                    }
+                pthread_mutex_unlock(&hdr->alloc_mutex);
+                return offset;
+            };
+
+            inline
+            optr_implem::owning_shm_header*
+                header() const {
+                return reinterpret_cast<optr_implem::owning_shm_header*>(this->base);
+            };
+            inline
+            optr_implem::owning_shm_register*
+                register_at(uint64_t offset) const {
+                return reinterpret_cast<optr_implem::owning_shm_register*>(this->base + offset);
+            };
+            inline
+            void*
+                object_at(uint64_t offset) const {
+                return this->base + offset + optr_implem::shm_align_up(sizeof(optr_implem::owning_shm_register));
+            };
+
+            ///Allocate register+object block for type_size bytes, returning register offset
+            inline
+            uint64_t
+                allocate(uint32_t type_size)
+            {
+                const uint64_t need = optr_implem::shm_align_up(sizeof(optr_implem::owning_shm_register))
+                                    + optr_implem::shm_align_up(type_size);
+                auto hdr = header();
+
+                optr_implem::shm_mutex_lock(&hdr->alloc_mutex);
+                uint64_t offset = 0;
+                for ( uint64_t* link = &hdr->free_head; *link != 0; link = &register_at(*link)->next_free )
+                {
+                    if ( register_at(*link)->block_size >= need )  //first fit, no split
+                    {
+                        offset = *link;
+                        *link = register_at(offset)->next_free;
+                        break;
+                    }
+                }
+                if ( offset == 0 && hdr->bump + need <= hdr->size )
+                {
+                    offset = hdr->bump;
+                    hdr->bump += need;
+                    register_at(offset)->block_size = need;
+                    optr_implem::shm_mutex_init(&register_at(offset)->mutex_optr);
+                }
+                pthread_mutex_unlock(&hdr->alloc_mutex);
+
+                if ( offset == 0 )
+                    throw std::bad_alloc();
+
+                auto rgstr = register_at(offset);
+                rgstr->share_count.store(0, std::memory_order_relaxed);
+                rgstr->generation.fetch_add(1, std::memory_order_release);
+                rgstr->b_alive.store(0, std::memory_order_relaxed);
+                rgstr->type_size = type_size;
+                rgstr->next_free = 0;
+                return offset;
+            };
+            ///Return block to free list and drop its published names ( mutex kept initialized for reuse )
+            inline
+            void
+                deallocate(uint64_t offset)
+            {
+                auto hdr = header();
+                optr_implem::shm_mutex_lock(&hdr->alloc_mutex);
+                for ( auto& nm : hdr->names )
+                    if ( nm.offset.load(std::memory_order_relaxed) == offset )
+                    {
+                        nm.name[0] = '\0';
+                        nm.offset.store(0, std::memory_order_relaxed);
+                        nm.generation = 0;
+                    }
+                register_at(offset)->type_size = 0;
+                register_at(offset)->next_free = hdr->free_head;
+                hdr->free_head = offset;
+                pthread_mutex_unlock(&hdr->alloc_mutex);
+            };
+
+            unsigned char* base = nullptr;  ///< mapping address in this process
+            size_t size = 0;                ///< mapped bytes
+
+            /// - deleted
+            owning_shm_segment(const owning_shm_segment&) = delete;
+    };  // end of owning_shm_segment class
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Process-shared lock on shared-memory object until out of scope              --------------------------
+    template <typename OwnedType>
+    class owning_shm_lock
+    {
+        template <typename OT>
+        friend class owning_shm_ptr;
+
+        public:
+            ///Move Constructor
+            owning_shm_lock(owning_shm_lock&& mv)
+            :
+                o_register(mv.o_register),
+                ltptr(mv.ltptr)
+            {
+                mv.o_register = nullptr;
+            };
+            ///Destructor ( unlock )
+            ~owning_shm_lock()
+            {
+                if ( this->o_register != nullptr )
+                    pthread_mutex_unlock(&this->o_register->mutex_optr);
+            };
+
+            ///Access Operator
+            inline __attribute__((always_inline))
+            OwnedType*
+                operator->() const {
+                return this->ltptr;
+            };
+            ///Owner-Alive status ( owner may live in another process )
+            inline __attribute__((always_inline))
+            bool
+                alive() const {
+                return this->o_register->b_alive.load(std::memory_order_acquire) != 0;
+            };
+
+        private:
+            ///Constructor ( lock )
+            owning_shm_lock(optr_implem::owning_shm_register* rgstr,
+                            OwnedType* ptr)
+            :
+                o_register(rgstr),
+                ltptr(ptr)
+            {
+                optr_implem::shm_mutex_lock(&this->o_register->mutex_optr);
+            };
+
+            optr_implem::owning_shm_register* o_register;   ///< locked register ( nullptr : moved from )
+            OwnedType* ltptr;                               ///< shared object
+
+            /// - deleted
+            owning_shm_lock(const owning_shm_lock&) = delete;
+    };  // end of owning_shm_lock class
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Shared pointer into a shared-memory segment                                  --------------------------
+    template <typename OwnedType>
+    class owning_shm_ptr
+    {
+        static_assert(std::is_trivially_copyable<OwnedType>::value, "owning_shm_ptr requires trivially copyable type");
+
+        friend class owning_shm_segment;
+
+        public:
+            ///Empty Constructor
+            owning_shm_ptr()
+            {};
+            ///Share Constructor
+            owning_shm_ptr(const owning_shm_ptr& cp)
+            :
+                o_segment(cp.o_segment),
+                o_offset(cp.o_offset)
+            {
+                bump_up();
+            };
+            ///Move Constructor
+            owning_shm_ptr(owning_shm_ptr&& mv)
+            :
+                o_segment(mv.o_segment),
+                o_offset(mv.o_offset)
+            {
+                mv.o_offset = 0;
+            };
+            ///Destructor
+            virtual ~owning_shm_ptr()
+            {
+                clean_base();
+            };
+
+            ///Assignment Operator
+            inline
+            owning_shm_ptr&
+                operator=(owning_shm_ptr ass)
+            {
+                std::swap(this->o_segment, ass.o_segment);
+                std::swap(this->o_offset, ass.o_offset);
+                return *this;
+            };
+
+            ///Access Operator
+            inline __attribute__((always_inline))
+            OwnedType*
+                operator->() const {
+                return get();
+            };
+            ///DeReference Operator
+            inline __attribute__((always_inline))
+            OwnedType&
+                operator*() const {
+                return *get();
+            };
+            ///Get Raw Pointer ( valid in this process only )
+            inline __attribute__((always_inline))
+            OwnedType*
+                get() const
+            {
+                if ( this->o_offset == 0 )
+                    return nullptr;
+                return std::launder(static_cast<OwnedType*>(this->o_segment->object_at(this->o_offset)));
+            };
+
+            ///Returns process-shared-mutex-locked container with object pointer
+            inline
+            owning_shm_lock<OwnedType>
+                get_lock() const {
+                return owning_shm_lock<OwnedType>(rgstr(), get());
+            };
+
+            ///Get owner alive status ( owner may live in another process )
+            inline __attribute__((always_inline))
+            bool
+                alive() const
+            {
+                if ( this->o_offset == 0 )
+                    return false;   //has not been made
+                return rgstr()->b_alive.load(std::memory_order_acquire) != 0;
+            };
+            ///Share count across all processes
+            inline __attribute__((always_inline))
+            size_t
+                use_count() const
+            {
+                if ( this->o_offset == 0 )
+                    return 0;
+                return rgstr()->share_count.load(std::memory_order_relaxed);
+            };
+            ///Register offset in segment ( for publish / attach )
+            inline __attribute__((always_inline))
+            uint64_t
+                offset() const {
+                return this->o_offset;
+            };
+
+        protected:
+            ///Attach Constructor ( takes a share )
+            owning_shm_ptr(owning_shm_segment* seg,
+                           uint64_t offset)
+            :
+                o_segment(seg),
+                o_offset(offset)
+            {
+                bump_up();
+            };
+
+            inline __attribute__((always_inline))
+            optr_implem::owning_shm_register*
+                rgstr() const {
+                return this->o_segment->register_at(this->o_offset);
+            };
+
+            owning_shm_segment* o_segment = nullptr;    ///< mapping in this process
+            uint64_t o_offset = 0;                      ///< register offset ( 0 : null )
+
+        private:
+            inline __attribute__((always_inline))
+            void
+                bump_up()
+            {
+                if ( this->o_offset != 0 )
+                    rgstr()->share_count.fetch_add(1, std::memory_order_relaxed);
+            };
+            inline __attribute__((always_inline))
+            void
+                clean_base()
+            {
+                if ( this->o_offset == 0 )
+                    return;
+
+                if ( rgstr()->share_count.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+                    this->o_segment->deallocate(this->o_offset);
+                this->o_offset = 0;
+            };
+    };  // end of owning_shm_ptr class
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Owner of a shared-memory object                                              --------------------------
+    template <typename OwnedType>
+    class owning_shm_owner
+    :
+        public owning_shm_ptr<OwnedType>
+    {
+        template <typename OT, typename... Args>
+        friend owning_shm_owner<OT>
+            make_owning_shm_owner(owning_shm_segment& seg,
+                                  Args&&... args);
+
+        public:
+            ///Empty Constructor
+            owning_shm_owner()
+            {};
+            ///Move Constructor
+            owning_shm_owner(owning_shm_owner&& mv)
+            :
+                owning_shm_ptr<OwnedType>(std::move(mv))
+            {};
+            ///Destructor ( owner death visible to every process )
+            virtual ~owning_shm_owner()
+            {
+                if ( this->o_offset != 0 )
+                    this->rgstr()->b_alive.store(0, std::memory_order_release);
+            };
+
+            ///Assignment Move Operator
+            inline
+            owning_shm_owner&
+                operator=(owning_shm_owner&& mass)
+            {
+                if ( this->o_offset != 0 )
+                    this->rgstr()->b_alive.store(0, std::memory_order_release);
+                owning_shm_ptr<OwnedType>::operator=(std::move(mass));
+                return *this;
+            };
+
+        private:
+            ///Make Constructor
+            owning_shm_owner(owning_shm_segment* seg,
+                             uint64_t offset)
+            :
+                owning_shm_ptr<OwnedType>(seg, offset)
+            {
+                this->rgstr()->b_alive.store(1, std::memory_order_release);
+            };
+
+            /// - deleted
+            owning_shm_owner(const owning_shm_owner&) = delete;
+    };  // end of owning_shm_owner class
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Make owning_shm_owner in segment                                             --------------------------
+    template <typename OwnedType, typename... Args>
+    inline
+    owning_shm_owner<OwnedType>
+        make_owning_shm_owner(owning_shm_segment& seg,
+                              Args&&... args)
+    {
+        const auto offset = seg.allocate(static_cast<uint32_t>(sizeof(OwnedType)));
+        try
+        {
+            new (seg.object_at(offset)) OwnedType(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            seg.deallocate(offset);
+            throw;
+        }
+        return owning_shm_owner<OwnedType>(&seg, offset);
+    };
+
+};  // end of optr namespace
+
+#endif // STR_LIFETIME_PTR_SHM_HPP
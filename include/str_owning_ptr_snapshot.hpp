@@ -0,0 +1,506 @@
+#ifndef STR_LIFETIME_PTR_SNAPSHOT_HPP
+#define STR_LIFETIME_PTR_SNAPSHOT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <str_owning_ptr.hpp>
+
+///-------------------------------------------------------------------------------------------------------
+/// Handle-only snapshots of owning_ptr_o object graphs.
+///
+/// Every register reachable from the written roots is stored exactly once; owning_ptr_o links between
+/// objects are stored as record indices. Loading rebuilds the same sharing topology, placing all
+/// registers and objects of a snapshot in one arena allocation.
+///
+/// Types taking part provide ( found by ADL ):
+///   void optr_save(optr::owning_snapshot_writer& w, const T& obj);   // w.put(...), w.link(...)
+///   void optr_load(optr::owning_snapshot_reader& r, T& obj);         // r.get<...>(), r.link<...>()
+/// and must be default constructible. Every link to one register must use the same type ( a register reached
+/// through both owning_ptr_o<Base> and owning_ptr_o<Derived> is rejected by the writer ), and links must be
+/// read back with the type they were written with.
+///
+/// Loaded objects report alive() false until their owner is claimed: load_owner() for one record, or
+/// load_alive_owners() for every loaded record whose owner was alive when written.
+///-------------------------------------------------------------------------------------------------------
+
+namespace optr
+{
+    class owning_snapshot_writer;
+    class owning_snapshot_reader;
+
+    namespace optr_implem
+    {
+        ///Snapshot stream layout
+        constexpr uint32_t SNAP_MAGIC_   = 0x3153504F;   ///< "OPS1"
+        constexpr uint32_t SNAP_NULL_    = 0xFFFFFFFF;   ///< index of a null link
+        constexpr uint32_t SNAP_F_ALIVE_ = 0x1;          ///< record owner was alive when written
+        constexpr uint64_t SNAP_MAX_ALIGN_ = 4096;       ///< largest arena alignment accepted on load
+
+        ///Stream header
+        struct owning_snapshot_header
+        {
+            uint32_t magic;
+            uint32_t n_records;
+            uint64_t arena_size;
+            uint64_t arena_align;
+            uint64_t payload_size;
+        };
+        ///Per-record table entry
+        struct owning_snapshot_record
+        {
+            uint64_t arena_offset;      ///< block position in arena
+            uint64_t payload_offset;    ///< optr_save bytes position in payload
+            uint64_t payload_size;      ///< optr_save bytes count
+            uint32_t block_size;        ///< sizeof(owning_ptr_arena_block<T>) ( type check )
+            uint32_t flags;             ///< SNAP_F_ flags
+        };
+    };  // end of optr_implem namespace
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Write owning_ptr_o object graph to a compact binary stream                   --------------------------
+    class owning_snapshot_writer
+    {
+        public:
+            ///Default Constructor
+            owning_snapshot_writer()
+            {};
+
+            ///Add object graph root, returning its record index
+            ///- objects are saved as they are reached; caller keeps the graph alive until finish()
+            template <typename OwnedType>
+            inline
+            uint32_t
+                write(const owning_ptr_o<OwnedType>& root)
+            {
+                const auto idx = index_of(root);
+                drain();
+                return idx;
+            };
+
+            ///Save link to another object ( call from optr_save )
+            template <typename OwnedType>
+            inline
+            void
+                link(const owning_ptr_o<OwnedType>& lnk){
+                put<uint32_t>(index_of(lnk));
+            };
+
+            ///Save trivially copyable value ( call from optr_save )
+            template <typename ValType>
+            inline
+            void
+                put(const ValType& val)
+            {
+                static_assert(std::is_trivially_copyable<ValType>::value, "owning_snapshot_writer::put requires trivially copyable type");
+                put_bytes(&val, sizeof(ValType));
+            };
+            ///Save raw bytes ( call from optr_save )
+            inline
+            void
+                put_bytes(const void* src,
+                          size_t n_bytes)
+            {
+                auto bsrc = static_cast<const unsigned char*>(src);
+                this->payload.insert(this->payload.end(), bsrc, bsrc + n_bytes);
+            };
+
+            ///Number of distinct registers written
+            inline
+            size_t
+                size() const {
+                return this->records.size();
+            };
+
+            ///Produce snapshot stream
+            inline
+            std::vector<unsigned char>
+                finish() const
+            {
+                optr_implem::owning_snapshot_header hdr;
+                hdr.magic        = optr_implem::SNAP_MAGIC_;
+                hdr.n_records    = static_cast<uint32_t>(this->records.size());
+                hdr.arena_size   = this->arena_size;
+                hdr.arena_align  = this->arena_align;
+                hdr.payload_size = this->payload.size();
+
+                const size_t n_table = this->records.size() * sizeof(optr_implem::owning_snapshot_record);
+
+                std::vector<unsigned char> out(sizeof(hdr) + n_table + this->payload.size());
+                std::memcpy(out.data(), &hdr, sizeof(hdr));
+                if ( n_table > 0 )
+                    std::memcpy(out.data() + sizeof(hdr), this->records.data(), n_table);
+                if ( !this->payload.empty() )
+                    std::memcpy(out.data() + sizeof(hdr) + n_table, this->payload.data(), this->payload.size());
+                return out;
+            };
+
+        private:
+            ///Save function of a queued record
+            using SAVE_FN_ = void(*)(owning_snapshot_writer&, const void*);
+
+            ///Record reached but not yet saved
+            struct pending_save
+            {
+                uint32_t idx;
+                const void* obj;
+                SAVE_FN_ save;
+            };
+
+            ///Record index of register, queueing it for save when first seen
+            template <typename OwnedType>
+            inline
+            uint32_t
+                index_of(const owning_ptr_o<OwnedType>& lnk)
+            {
+                using BLOCK_ = optr_implem::owning_ptr_arena_block<OwnedType>;
+
+                const void* rgstr = optr_implem::owning_ptr_access::register_of(lnk);
+                if ( rgstr == nullptr )
+                    return optr_implem::SNAP_NULL_;
+
+                auto found = this->index_map.find(rgstr);
+                if ( found != this->index_map.end() )
+                {
+                    if ( this->queue[found->second].save != &save_record<OwnedType> )
+                        throw std::logic_error("owning_snapshot_writer: register linked with different types");
+                    return found->second;
+                }
+
+                const auto idx = static_cast<uint32_t>(this->records.size());
+                this->index_map.emplace(rgstr, idx);
+
+                //lay out arena position now so loading needs no size pass
+                this->arena_size = (this->arena_size + alignof(BLOCK_) - 1) / alignof(BLOCK_) * alignof(BLOCK_);
+                if ( alignof(BLOCK_) > this->arena_align )
+                    this->arena_align = alignof(BLOCK_);
+
+                optr_implem::owning_snapshot_record rec;
+                rec.arena_offset   = this->arena_size;
+                rec.payload_offset = 0;
+                rec.payload_size   = 0;
+                rec.block_size     = static_cast<uint32_t>(sizeof(BLOCK_));
+                rec.flags          = 0;
+                if constexpr ( owning_traits<OwnedType>::alive_flag )
+                    rec.flags = lnk.alive() ? optr_implem::SNAP_F_ALIVE_ : 0;
+                this->records.push_back(rec);
+
+                this->arena_size += sizeof(BLOCK_);
+
+                this->queue.push_back({ idx, lnk.get(), &save_record<OwnedType> });
+                return idx;
+            };
+
+            ///Save queued records ( breadth first, so each payload is contiguous )
+            inline
+            void
+                drain()
+            {
+                while ( this->n_saved < this->queue.size() )
+                {
+                    const auto pend = this->queue[this->n_saved++];
+
+                    this->records[pend.idx].payload_offset = this->payload.size();
+                    pend.save(*this, pend.obj);
+                    this->records[pend.idx].payload_size = this->payload.size() - this->records[pend.idx].payload_offset;
+                }
+            };
+
+            ///Typed optr_save dispatch
+            template <typename OwnedType>
+            static
+            void
+                save_record(owning_snapshot_writer& wrtr,
+                            const void* obj){
+                optr_save(wrtr, *static_cast<const OwnedType*>(obj));
+            };
+
+            std::unordered_map<const void*, uint32_t> index_map;        ///< register -> record index
+            std::vector<optr_implem::owning_snapshot_record> records;   ///< record table
+            std::vector<pending_save> queue;                            ///< records in save order ( same as record index )
+            std::vector<unsigned char> payload;                         ///< optr_save bytes
+            size_t n_saved = 0;                                         ///< queue entries saved
+            uint64_t arena_size = 0;                                    ///< arena bytes needed on load
+            uint64_t arena_align = alignof(std::max_align_t);           ///< arena alignment needed on load
+
+            /// - deleted
+            owning_snapshot_writer(const owning_snapshot_writer&) = delete;
+    };  // end of owning_snapshot_writer class
+
+    ///-------------------------------------------------------------------------------------------------------
+    ///Rebuild owning_ptr_o object graph from snapshot stream                       --------------------------
+    class owning_snapshot_reader
+    {
+        public:
+            ///Parse stream and allocate arena for all records ( stream must outlive reader )
+            owning_snapshot_reader(const unsigned char* data,
+                                   size_t n_bytes)
+            {
+                if ( n_bytes < sizeof(this->header) )
+                    throw std::runtime_error("owning_snapshot_reader: truncated header");
+                std::memcpy(&this->header, data, sizeof(this->header));
+
+                if ( this->header.magic != optr_implem::SNAP_MAGIC_ )
+                    throw std::runtime_error("owning_snapshot_reader: bad magic");
+
+                const uint64_t n_table = uint64_t(this->header.n_records) * sizeof(optr_implem::owning_snapshot_record);
+                if ( n_bytes - sizeof(this->header) < n_table
+                     || n_bytes - sizeof(this->header) - n_table < this->header.payload_size )
+                    throw std::runtime_error("owning_snapshot_reader: truncated stream");
+
+                this->records.resize(this->header.n_records);
+                if ( n_table > 0 )
+                    std::memcpy(this->records.data(), data + sizeof(this->header), n_table);
+                this->payload = data + sizeof(this->header) + n_table;
+
+                const uint64_t align = this->header.arena_align;
+                if ( align == 0 || ( align & ( align - 1 ) ) != 0 || align > optr_implem::SNAP_MAX_ALIGN_ )
+                    throw std::runtime_error("owning_snapshot_reader: bad arena alignment");
+
+                //written as differences so corrupted offsets can't wrap past the checks
+                std::vector<std::pair<uint64_t, uint64_t>> spans;   //arena offset, block size
+                spans.reserve(this->records.size());
+                for ( const auto& rec : this->records )
+                {
+                    if ( rec.arena_offset > this->header.arena_size
+                         || rec.block_size > this->header.arena_size - rec.arena_offset
+                         || rec.payload_offset > this->header.payload_size
+                         || rec.payload_size > this->header.payload_size - rec.payload_offset )
+                        throw std::runtime_error("owning_snapshot_reader: record out of range");
+                    spans.emplace_back(rec.arena_offset, rec.block_size);
+                }
+
+                //each record is constructed in place, so no two may share arena bytes
+                std::sort(spans.begin(), spans.end());
+                for ( size_t i = 1; i < spans.size(); ++i )
+                {
+                    if ( spans[i].first - spans[i - 1].first < spans[i - 1].second )
+                        throw std::runtime_error("owning_snapshot_reader: overlapping records");
+                }
+
+                this->loaded.assign(this->records.size(), nullptr);
+                this->loaded_as.assign(this->records.size(), nullptr);
+                this->claimed.assign(this->records.size(), false);
+                this->arena = optr_implem::owning_ptr_arena::create(this->header.arena_size,
+                                                                    this->header.arena_align);
+            };
+            ///Parse stream held in vector
+            explicit owning_snapshot_reader(const std::vector<unsigned char>& data)
+            :
+                owning_snapshot_reader(data.data(), data.size())
+            {};
+
+            ///Destructor ( arena lives on while loaded objects are shared )
+            ~owning_snapshot_reader()
+            {
+                while ( this->n_loaded < this->queue.size() )   //load aborted by exception
+                    optr_implem::owning_ptr_access::unhold(this->loaded[this->queue[this->n_loaded++].idx]);
+
+                this->arena->release();
+            };
+
+            ///Load record and everything reachable from it
+            template <typename OwnedType>
+            inline
+            owning_ptr_o<OwnedType>
+                load(uint32_t idx)
+            {
+                auto optr = handle<OwnedType>(idx);
+                drain();
+                return optr;
+            };
+            ///Load record as its owner ( alive() true until returned owner is destroyed )
+            template <typename OwnedType>
+            inline
+            owning_owner_o<OwnedType>
+                load_owner(uint32_t idx)
+            {
+                auto keep = load<OwnedType>(idx);  //record may have no other sharer yet
+                if ( this->claimed[idx] )
+                    throw std::logic_error("owning_snapshot_reader: record owner already claimed");
+                return claim_owner<OwnedType>(idx);
+            };
+            ///Claim owners of every record loaded as OwnedType that was alive when written
+            ///- call after loading roots; records already claimed or not yet reached are skipped
+            template <typename OwnedType>
+            inline
+            std::vector<owning_owner_o<OwnedType>>
+                load_alive_owners()
+            {
+                std::vector<owning_owner_o<OwnedType>> owners;
+                for ( uint32_t idx = 0; idx < this->records.size(); ++idx )
+                {
+                    if ( this->loaded_as[idx] == &load_record<OwnedType>
+                         && !this->claimed[idx]
+                         && was_alive(idx) )
+                        owners.push_back(claim_owner<OwnedType>(idx));
+                }
+                return owners;
+            };
+
+            ///Load link to another object ( call from optr_load )
+            template <typename OwnedType>
+            inline
+            owning_ptr_o<OwnedType>
+                link(){
+                return handle<OwnedType>(get<uint32_t>());
+            };
+
+            ///Load trivially copyable value ( call from optr_load )
+            template <typename ValType>
+            inline
+            ValType
+                get()
+            {
+                static_assert(std::is_trivially_copyable<ValType>::value, "owning_snapshot_reader::get requires trivially copyable type");
+                ValType val;
+                get_bytes(&val, sizeof(ValType));
+                return val;
+            };
+            ///Load raw bytes ( call from optr_load )
+            inline
+            void
+                get_bytes(void* dst,
+                          size_t n_bytes)
+            {
+                if ( this->cursor_end - this->cursor < n_bytes )
+                    throw std::runtime_error("owning_snapshot_reader: read past record payload");
+                std::memcpy(dst, this->payload + this->cursor, n_bytes);
+                this->cursor += n_bytes;
+            };
+
+            ///Number of records in snapshot
+            inline
+            size_t
+                size() const {
+                return this->records.size();
+            };
+            ///Whether record's owner was alive when written
+            inline
+            bool
+                was_alive(uint32_t idx) const {
+                return ( this->records.at(idx).flags & optr_implem::SNAP_F_ALIVE_ ) != 0;
+            };
+
+        private:
+            ///Load function of a constructed record
+            using LOAD_FN_ = void(*)(owning_snapshot_reader&, void*);
+
+            ///Record constructed but payload not yet loaded
+            struct pending_load
+            {
+                uint32_t idx;
+                LOAD_FN_ load;
+            };
+
+            ///Shared pointer to record, constructing it in arena when first reached
+            template <typename OwnedType>
+            inline
+            owning_ptr_o<OwnedType>
+                handle(uint32_t idx)
+            {
+                using BLOCK_ = optr_implem::owning_ptr_arena_block<OwnedType>;
+
+                if ( idx == optr_implem::SNAP_NULL_ )
+                    return owning_ptr_o<OwnedType>();
+
+                const auto& rec = this->records.at(idx);
+                if ( rec.block_size != sizeof(BLOCK_) )
+                    throw std::runtime_error("owning_snapshot_reader: record type mismatch");
+                if ( rec.arena_offset % alignof(BLOCK_) != 0 || this->header.arena_align < alignof(BLOCK_) )
+                    throw std::runtime_error("owning_snapshot_reader: misaligned record");
+
+                if ( this->loaded[idx] != nullptr && this->loaded_as[idx] != &load_record<OwnedType> )
+                    throw std::runtime_error("owning_snapshot_reader: record loaded with different types");
+
+                if ( this->loaded[idx] == nullptr )
+                {
+                    auto blk = BLOCK_::place(this->arena->data() + rec.arena_offset, this->arena);
+                    try
+                    {
+                        new (blk->storage()) OwnedType();
+                    }
+                    catch (...)
+                    {
+                        blk->unplace();
+                        throw;
+                    }
+
+                    optr_implem::owning_ptr_access::hold(blk);  //held by reader until payload loaded
+                    this->loaded[idx] = blk;
+                    this->loaded_as[idx] = &load_record<OwnedType>;
+                    this->queue.push_back({ idx, &load_record<OwnedType> });
+                }
+
+                auto blk = static_cast<BLOCK_*>(this->loaded[idx]);
+                return optr_implem::owning_ptr_access::make_ptr_o<OwnedType>(blk, blk->object());
+            };
+
+            ///Owner of loaded record ( not yet claimed )
+            template <typename OwnedType>
+            inline
+            owning_owner_o<OwnedType>
+                claim_owner(uint32_t idx)
+            {
+                this->claimed[idx] = true;
+
+                auto blk = static_cast<optr_implem::owning_ptr_arena_block<OwnedType>*>(this->loaded[idx]);
+                return optr_implem::owning_ptr_access::make_owner_o<OwnedType>(blk, blk->object());
+            };
+
+            ///Load payloads of constructed records ( iterative, no recursion through links )
+            inline
+            void
+                drain()
+            {
+                while ( this->n_loaded < this->queue.size() )
+                {
+                    const auto pend = this->queue[this->n_loaded++];
+                    const auto& rec = this->records[pend.idx];
+
+                    this->cursor     = rec.payload_offset;
+                    this->cursor_end = rec.payload_offset + rec.payload_size;
+                    pend.load(*this, this->loaded[pend.idx]);
+
+                    optr_implem::owning_ptr_access::unhold(this->loaded[pend.idx]);
+                }
+            };
+
+            ///Typed optr_load dispatch
+            template <typename OwnedType>
+            static
+            void
+                load_record(owning_snapshot_reader& rdr,
+                            void* rgstr)
+            {
+                auto blk = static_cast<optr_implem::owning_ptr_arena_block<OwnedType>*>(
+                               static_cast<optr_implem::owning_ptr_register*>(rgstr));
+                optr_load(rdr, *blk->object());
+            };
+
+            optr_implem::owning_snapshot_header header;                 ///< stream header
+            std::vector<optr_implem::owning_snapshot_record> records;   ///< record table
+            const unsigned char* payload = nullptr;                     ///< optr_save bytes
+            optr_implem::owning_ptr_arena* arena = nullptr;             ///< single allocation for all records
+            std::vector<optr_implem::owning_ptr_register*> loaded;      ///< constructed records
+            std::vector<LOAD_FN_> loaded_as;                            ///< typed load function of constructed records
+            std::vector<bool> claimed;                                  ///< records handed out as owners
+            std::vector<pending_load> queue;                            ///< records in construction order
+            size_t n_loaded = 0;                                        ///< queue entries loaded
+            uint64_t cursor = 0;                                        ///< read position in payload
+            uint64_t cursor_end = 0;                                    ///< end of current record payload
+
+            /// - deleted
+            owning_snapshot_reader(const owning_snapshot_reader&) = delete;
+    };  // end of owning_snapshot_reader class
+
+};  // end of optr namespace
+
+#endif // STR_LIFETIME_PTR_SNAPSHOT_HPP
@@ -0,0 +1,101 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <str_owning_ptr.hpp>
+
+///-------------------------------------------------------------------------------------------------------
+/// False-sharing microbenchmark for owning_traits<T>::isolate_refcount.
+///
+/// Two threads copy and destroy handles to one object ( share_count RMWs ) while a third polls alive().
+/// With the default layout the alive flag shares a cache line with share_count; isolated, it has its own.
+/// The difference only shows with the threads on separate cores ( ideally separate sockets ).
+///
+///   bench_false_sharing [copies per thread]
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    ///Default layout
+    struct Plain
+    {
+        int value = 0;
+    };
+    ///Alive flag and mutex on their own cache line
+    struct Isolated
+    {
+        int value = 0;
+    };
+};
+
+template <>
+struct optr::owning_traits<Isolated>
+:
+    public optr::owning_traits_default
+{
+    static constexpr bool isolate_refcount = true;
+};
+
+namespace
+{
+    ///Nanoseconds per handle copy for OwnedType
+    template <typename OwnedType>
+    double
+        run(const size_t n_copies)
+    {
+        auto own = optr::make_owning_owner_o<OwnedType>();
+        const optr::owning_ptr_o<OwnedType> shared = own;
+
+        std::atomic<bool> b_stop{false};
+        std::atomic<size_t> n_polls{0};
+        std::thread poller([&]()
+        {
+            size_t n_alive = 0;
+            while ( !b_stop.load(std::memory_order_relaxed) )
+                n_alive += shared.alive();
+            n_polls.store(n_alive, std::memory_order_relaxed);
+        });
+
+        const auto t0 = std::chrono::steady_clock::now();
+        std::vector<std::thread> copiers;
+        for ( int t = 0; t < 2; t++ )
+        {
+            copiers.emplace_back([&]()
+            {
+                for ( size_t i = 0; i < n_copies; i++ )
+                {
+                    optr::owning_ptr_o<OwnedType> cp = shared;
+                    (void)cp;
+                }
+            });
+        }
+        for ( auto& thr : copiers )
+            thr.join();
+        const auto t1 = std::chrono::steady_clock::now();
+
+        b_stop.store(true, std::memory_order_relaxed);
+        poller.join();
+
+        const double n_ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        return n_ns / static_cast<double>(n_copies);
+    };
+};
+
+int main(int argc, char** argv)
+{
+    const size_t n_copies = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+
+    std::printf("register_o size : plain %zu, isolated %zu bytes\n",
+                sizeof(optr::optr_implem::register_o_of<Plain>),
+                sizeof(optr::optr_implem::register_o_of<Isolated>));
+    for ( int rep = 0; rep < 3; rep++ )
+    {
+        const double ns_plain    = run<Plain>(n_copies);
+        const double ns_isolated = run<Isolated>(n_copies);
+        std::printf("plain %7.2f ns/copy   isolated %7.2f ns/copy\n", ns_plain, ns_isolated);
+    }
+    return 0;
+}
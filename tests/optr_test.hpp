@@ -0,0 +1,92 @@
+#ifndef STR_LIFETIME_PTR_TEST_HPP
+#define STR_LIFETIME_PTR_TEST_HPP
+
+#include <cstdio>
+#include <exception>
+#include <vector>
+
+///-------------------------------------------------------------------------------------------------------
+/// Minimal self-registering test cases ( no external framework ).
+///
+///   OPTR_TEST(name) { OPTR_CHECK(cond); }
+///   int main(){ return optr_test::run_all(); }
+///-------------------------------------------------------------------------------------------------------
+
+namespace optr_test
+{
+    ///Registered test case
+    struct test_case
+    {
+        const char* name;
+        void (*fn)();
+    };
+
+    ///All registered cases, in definition order
+    inline
+    std::vector<test_case>&
+        registry()
+    {
+        static std::vector<test_case> cases;
+        return cases;
+    };
+    ///Failed checks in current case
+    inline
+    int&
+        failures()
+    {
+        static int n_fail = 0;
+        return n_fail;
+    };
+
+    ///Registers a case at static initialization
+    struct registrar
+    {
+        registrar(const char* name,
+                  void (*fn)()){
+            registry().push_back({ name, fn });
+        };
+    };
+
+    ///Run every case, returning number of failed cases
+    inline
+    int
+        run_all()
+    {
+        int n_failed = 0;
+        for ( const auto& tc : registry() )
+        {
+            failures() = 0;
+            try
+            {
+                tc.fn();
+            }
+            catch ( const std::exception& ex )
+            {
+                std::printf("  unexpected exception: %s\n", ex.what());
+                failures()++;
+            }
+
+            std::printf("%s %s\n", failures() == 0 ? "[ OK ]" : "[FAIL]", tc.name);
+            if ( failures() != 0 )
+                n_failed++;
+        }
+        std::printf("%d of %zu cases failed\n", n_failed, registry().size());
+        return n_failed;
+    };
+};  // end of optr_test namespace
+
+#define OPTR_TEST(name)                                                         \
+    static void name();                                                         \
+    static optr_test::registrar name##_registrar(#name, &name);                 \
+    static void name()
+
+#define OPTR_CHECK(cond)                                                        \
+    do {                                                                        \
+        if ( !(cond) )                                                          \
+        {                                                                       \
+            std::printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            optr_test::failures()++;                                            \
+        }                                                                       \
+    } while ( 0 )
+
+#endif // STR_LIFETIME_PTR_TEST_HPP
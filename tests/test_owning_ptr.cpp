@@ -0,0 +1,770 @@
+#include <atomic>
+#include <optional>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <str_owning_ptr.hpp>
+
+#include "optr_test.hpp"
+
+///-------------------------------------------------------------------------------------------------------
+/// Conformance and concurrency stress tests for owning_ptr_o / owning_ptr_v.
+/// Build with -DOPTR_SANITIZE_ADDRESS=ON / _UNDEFINED=ON / _THREAD=ON to run under sanitizers.
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    struct SelfShared;
+    struct Mailboxed;
+};
+
+template <>
+struct optr::owning_traits<SelfShared>
+:
+    public optr::owning_traits_default
+{
+    static constexpr bool track_owner_thread = true;
+};
+template <>
+struct optr::owning_traits<Mailboxed>
+:
+    public optr::owning_traits_default
+{
+    static constexpr bool mailbox = true;
+};
+
+namespace
+{
+    std::atomic<long> n_live{0};   ///< Tracked objects currently constructed
+
+    ///Counts live instances
+    struct Tracked
+    {
+        Tracked(const int val = 0)
+        :
+            value(val)
+        {
+            n_live++;
+        };
+        Tracked(const Tracked& cp)
+        :
+            value(cp.value)
+        {
+            n_live++;
+        };
+        virtual ~Tracked(){
+            n_live--;
+        };
+
+        int value;
+    };
+    struct TrackedDerived
+    :
+        public Tracked
+    {
+        TrackedDerived(const int val)
+        :
+            Tracked(val)
+        {};
+
+        int extra = 7;
+    };
+
+    ///Hands out owning_ptr_o to itself
+    struct SelfShared
+    :
+        public optr::enable_owning_share_this
+    {
+        optr::owning_ptr_o<SelfShared>
+            self(){
+            return shared_from_this<optr::owning_ptr_o<SelfShared>>();
+        };
+
+        int value = 3;
+    };
+
+    ///Two fields writers keep equal ( upgradeable register mutex )
+    struct Ledger
+    {
+        long debit  = 0;
+        long credit = 0;
+    };
+
+    ///Receives posted closures ( register mailbox )
+    struct Mailboxed
+    :
+        public Tracked
+    {
+        Mailboxed(const int val = 0)
+        :
+            Tracked(val)
+        {};
+    };
+
+    ///Opted-out register layouts ( no alive flag / no mutex / neither )
+    struct Unflagged
+    :
+        public Tracked
+    {
+        using Tracked::Tracked;
+    };
+    struct Unlocked
+    :
+        public Tracked
+    {
+        using Tracked::Tracked;
+    };
+    struct Bare
+    :
+        public Tracked
+    {
+        using Tracked::Tracked;
+    };
+};
+
+template <>
+struct optr::owning_traits<Ledger>
+:
+    public optr::owning_traits_default
+{
+    static constexpr bool upgradeable = true;
+};
+template <>
+struct optr::owning_traits<Unflagged>
+:
+    public optr::owning_traits_default
+{
+    static constexpr bool alive_flag = false;
+};
+template <>
+struct optr::owning_traits<Unlocked>
+:
+    public optr::owning_traits_default
+{
+    static constexpr bool lockable = false;
+};
+template <>
+struct optr::owning_traits<Bare>
+:
+    public optr::owning_traits_default
+{
+    static constexpr bool alive_flag = false;
+    static constexpr bool lockable   = false;
+    static constexpr bool share_this = false;
+};
+
+static_assert(sizeof(optr::optr_implem::register_o_of<Bare>) < sizeof(optr::optr_implem::register_o_of<Unflagged>)
+              && sizeof(optr::optr_implem::register_o_of<Bare>) < sizeof(optr::optr_implem::register_o_of<Unlocked>)
+              && sizeof(optr::optr_implem::register_o_of<Unflagged>) < sizeof(optr::optr_implem::register_o_of<Tracked>)
+              && sizeof(optr::optr_implem::register_o_of<Unlocked>) < sizeof(optr::optr_implem::register_o_of<Tracked>),
+              "each opted-out part must shrink the register");
+
+///Owner, sharers, pooled and volatile registers of an opted-out type make, share and release like the default
+template <typename OptedOut>
+static void
+    check_opted_out_lifecycle()
+{
+    {
+        auto own = optr::make_owning_owner_o<OptedOut>(5);
+        optr::owning_ptr_o<OptedOut> shr = own;
+        optr::owning_ptr_o<OptedOut> cpy = shr;
+        OPTR_CHECK(own.use_count() == 3);
+        OPTR_CHECK(cpy->value == 5);
+        OPTR_CHECK(n_live == 1);
+
+        own = nullptr;      //held object outlives owner while shared
+        OPTR_CHECK(shr.use_count() == 2);
+        OPTR_CHECK(n_live == 1);
+    }
+    OPTR_CHECK(n_live == 0);
+
+    {
+        auto own = optr::make_pooled_owning_owner_o<OptedOut>(6);
+        std::vector<optr::owning_ptr_o<OptedOut>> shares(3, own);
+        own = nullptr;
+        shares.clear();
+    }
+    OPTR_CHECK(n_live == 0);
+
+    OptedOut obj(7);
+    {
+        auto own = optr::make_owning_owner_v<OptedOut>(&obj);
+        optr::owning_ptr_v<OptedOut> shr = own;
+        OPTR_CHECK(shr.use_count() == 2);
+        OPTR_CHECK(shr->value == 7);
+    }
+    OPTR_CHECK(n_live == 1);
+};
+
+///-------------------------------------------------------------------------------------------------------
+///MAKE / SHARE                                                             ------------------------------
+OPTR_TEST(make_owner_o_shares_and_releases)
+{
+    {
+        auto own = optr::make_owning_owner_o<Tracked>(5);
+        OPTR_CHECK(own.alive());
+        OPTR_CHECK(own.use_count() == 1);
+        OPTR_CHECK(own->value == 5);
+
+        optr::owning_ptr_o<Tracked> shr = own;
+        OPTR_CHECK(own.use_count() == 2);
+        OPTR_CHECK(shr == own);
+        OPTR_CHECK(shr.get() == own.get());
+        OPTR_CHECK(n_live == 1);
+    }
+    OPTR_CHECK(n_live == 0);
+
+    auto cpy = optr::make_owning_owner_o<Tracked>(Tracked(9));
+    OPTR_CHECK(cpy->value == 9);
+    cpy = nullptr;
+    OPTR_CHECK(n_live == 0);
+}
+
+OPTR_TEST(make_owner_v_does_not_own_object)
+{
+    Tracked obj(4);
+    optr::owning_ptr_v<Tracked> shr;
+    {
+        auto own = optr::make_owning_owner_v<Tracked>(&obj);
+        shr = own;
+        OPTR_CHECK(shr.alive());
+        OPTR_CHECK(shr.use_count() == 2);
+        OPTR_CHECK(shr->value == 4);
+    }
+    OPTR_CHECK(!shr.alive());
+    OPTR_CHECK(shr.use_count() == 1);
+    OPTR_CHECK(n_live == 1);    //volatile owner never deletes held object
+}
+
+OPTR_TEST(owner_v_moved_from_and_empty_destruct)
+{
+    Tracked obj;
+    {
+        optr::owning_owner_v<Tracked> empty;
+    }
+    {
+        auto own = optr::make_owning_owner_v<Tracked>(&obj);
+        optr::owning_ptr_v<Tracked> shr = own;
+        auto moved = std::move(own);
+        OPTR_CHECK(shr.alive());
+        OPTR_CHECK(shr.use_count() == 2);
+    }
+}
+
+///-------------------------------------------------------------------------------------------------------
+///CASTS                                                                    ------------------------------
+OPTR_TEST(casts_share_one_register)
+{
+    {
+        auto own = optr::make_owning_owner_o<TrackedDerived>(2);
+        optr::owning_ptr_o<Tracked> up = own;
+        OPTR_CHECK(up.use_count() == 2);
+        OPTR_CHECK(up->value == 2);
+
+        auto down = optr::owning_ptr_cast_o<TrackedDerived>(up);
+        OPTR_CHECK(down.use_count() == 3);
+        OPTR_CHECK(down->extra == 7);
+        OPTR_CHECK(down.alive());
+
+        up = nullptr;
+        OPTR_CHECK(down.use_count() == 2);
+        OPTR_CHECK(down.get_lock()->extra == 7);
+    }
+    OPTR_CHECK(n_live == 0);
+
+    TrackedDerived obj(1);
+    auto ownv = optr::make_owning_owner_v<TrackedDerived>(&obj);
+    optr::owning_ptr_v<Tracked> upv = ownv;
+    auto downv = optr::owning_ptr_cast_v<TrackedDerived>(upv);
+    OPTR_CHECK(downv.use_count() == 3);
+    OPTR_CHECK(downv->extra == 7);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///ALIVE TRANSITIONS                                                        ------------------------------
+OPTR_TEST(alive_follows_owner)
+{
+    optr::owning_ptr_o<Tracked> shr;
+    OPTR_CHECK(!shr.alive());
+    {
+        auto own = optr::make_owning_owner_o<Tracked>(1);
+        shr = own;
+        OPTR_CHECK(shr.alive());
+
+        auto moved = std::move(own);    //moving keeps owner alive
+        OPTR_CHECK(shr.alive());
+        OPTR_CHECK(shr.use_count() == 2);
+    }
+    OPTR_CHECK(!shr.alive());           //owner destroyed, sharer keeps object
+    OPTR_CHECK(shr->value == 1);
+    OPTR_CHECK(n_live == 1);
+    shr = nullptr;
+    OPTR_CHECK(n_live == 0);
+}
+
+OPTR_TEST(owner_move_assign_and_null_release_previous)
+{
+    auto own_a = optr::make_owning_owner_o<Tracked>(1);
+    auto own_b = optr::make_owning_owner_o<Tracked>(2);
+    optr::owning_ptr_o<Tracked> shr_a = own_a;
+    optr::owning_ptr_o<Tracked> shr_b = own_b;
+
+    own_a = std::move(own_b);
+    OPTR_CHECK(!shr_a.alive());
+    OPTR_CHECK(shr_a.use_count() == 1);
+    OPTR_CHECK(shr_b.alive());
+    OPTR_CHECK(own_a->value == 2);
+
+    own_a = nullptr;
+    OPTR_CHECK(!shr_b.alive());
+
+    shr_a = nullptr;
+    shr_b = nullptr;
+    OPTR_CHECK(n_live == 0);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///ENABLE_OWNING_SHARE_THIS                                                 ------------------------------
+OPTR_TEST(share_this_follows_owner_moves)
+{
+    auto own = optr::make_owning_owner_o<SelfShared>();
+    {
+        auto self = own->self();
+        OPTR_CHECK(self == own);
+        OPTR_CHECK(own.use_count() == 2);
+    }
+
+    auto moved = std::move(own);
+    auto self = moved->self();      //must read moved owner, not the emptied one
+    OPTR_CHECK(self == moved);
+    OPTR_CHECK(self.alive());
+    OPTR_CHECK(moved.use_count() == 2);
+
+    optr::owning_owner_o<SelfShared> target;
+    target = std::move(moved);
+    OPTR_CHECK(target->self() == target);
+}
+
+OPTR_TEST(share_this_empty_owner_moves)
+{
+    optr::owning_owner_o<SelfShared> empty;
+    optr::owning_owner_o<SelfShared> from_empty(std::move(empty));
+    OPTR_CHECK(from_empty.get() == nullptr);
+
+    optr::owning_owner_o<SelfShared> target;
+    target = std::move(from_empty);
+    OPTR_CHECK(target.get() == nullptr);
+
+    optr::owning_transfer_o<SelfShared> token;
+    optr::owning_transfer_o<SelfShared> moved_token(std::move(token));
+    OPTR_CHECK(!moved_token);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///OWNER TRANSFER                                                           ------------------------------
+OPTR_TEST(transfer_keeps_alive_and_records_thread)
+{
+    auto own = optr::make_owning_owner_o<SelfShared>();
+    optr::owning_ptr_o<SelfShared> watch = own;
+    OPTR_CHECK(own.owned_by_this_thread());
+
+    std::thread::id claimer;
+    optr::owning_owner_o<SelfShared> claimed;
+    auto token = own.release_to();
+    OPTR_CHECK(watch.alive());
+    OPTR_CHECK(watch.owner_thread() == std::thread::id());
+
+    std::thread th([&]()
+    {
+        claimed = token.claim();
+        claimer = std::this_thread::get_id();
+        OPTR_CHECK(claimed.owned_by_this_thread());
+        OPTR_CHECK(claimed->self() == claimed);
+    });
+    th.join();
+
+    OPTR_CHECK(watch.alive());
+    OPTR_CHECK(watch.owner_thread() == claimer);
+    OPTR_CHECK(!watch.owned_by_this_thread());
+
+    auto wrong = claimed.release_to(claimer);
+    bool b_threw = false;
+    try
+    {
+        auto own2 = wrong.claim();
+    }
+    catch ( const std::logic_error& )
+    {
+        b_threw = true;
+    }
+    OPTR_CHECK(b_threw);
+    OPTR_CHECK(watch.alive());
+}
+
+///-------------------------------------------------------------------------------------------------------
+///ASSIGNMENT REGRESSIONS                                                   ------------------------------
+OPTR_TEST(assign_same_register_keeps_count)
+{
+    auto own = optr::make_owning_owner_o<Tracked>();
+    optr::owning_ptr_o<Tracked> a = own;
+    optr::owning_ptr_o<Tracked> b = own;
+    for ( int i = 0; i < 100; i++ )
+    {
+        a = b;
+        a = a;
+    }
+    OPTR_CHECK(own.use_count() == 3);
+
+    a = nullptr;
+    b = nullptr;
+    own = nullptr;
+    OPTR_CHECK(n_live == 0);
+}
+
+///Object holding the only other share of its own register
+struct SelfHeld
+{
+    optr::owning_ptr_o<SelfHeld> next;
+};
+OPTR_TEST(assign_from_handle_inside_released_object)
+{
+    optr::owning_ptr_o<SelfHeld> hold;
+    {
+        auto own_a = optr::make_owning_owner_o<SelfHeld>();
+        auto own_b = optr::make_owning_owner_o<SelfHeld>();
+        own_a->next = own_b;
+        hold = own_a;
+    }
+    hold = hold->next;      //releases A, whose member holds the source handle
+    OPTR_CHECK(hold.use_count() == 1);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///OPTED-OUT LAYOUTS                                                        ------------------------------
+OPTR_TEST(opted_out_layouts_make_share_and_destroy)
+{
+    check_opted_out_lifecycle<Unflagged>();
+    check_opted_out_lifecycle<Unlocked>();
+    check_opted_out_lifecycle<Bare>();
+
+    auto own = optr::make_owning_owner_o<Unlocked>(1);
+    OPTR_CHECK(own.alive());
+    own = nullptr;
+    OPTR_CHECK(n_live == 0);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///POST MAILBOX                                                             ------------------------------
+OPTR_TEST(post_runs_in_order_and_survives_throw)
+{
+    auto own = optr::make_owning_owner_o<Mailboxed>(0);
+    optr::owning_ptr_o<Mailboxed> shr = own;
+
+    std::vector<int> order;
+    shr.post([&](Mailboxed& obj){ order.push_back(obj.value++); });
+    bool b_threw = false;
+    try
+    {
+        shr.post([](Mailboxed&){ throw std::runtime_error("closure failed"); });
+    }
+    catch ( const std::runtime_error& )
+    {
+        b_threw = true;
+    }
+    OPTR_CHECK(b_threw);
+
+    shr.post([&](Mailboxed& obj){ order.push_back(obj.value++); });   //mailbox must not be stuck
+    OPTR_CHECK(order.size() == 2);
+    OPTR_CHECK(order.size() == 2 && order[0] == 0 && order[1] == 1);
+
+    own = nullptr;
+    shr.post([&](Mailboxed&){ order.push_back(-1); });                //owner dead : dropped
+    OPTR_CHECK(order.size() == 2);
+}
+
+OPTR_TEST(post_concurrent_serializes)
+{
+    auto own = optr::make_owning_owner_o<Mailboxed>(0);
+    std::atomic<int> in_flight{0};
+    std::atomic<bool> b_overlap{false};
+
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < 4; t++ )
+        threads.emplace_back([&, shr = optr::owning_ptr_o<Mailboxed>(own)]() mutable
+        {
+            for ( int i = 0; i < 2000; i++ )
+                shr.post([&](Mailboxed& obj)
+                {
+                    if ( in_flight.fetch_add(1) != 0 )
+                        b_overlap = true;
+                    obj.value++;
+                    in_flight.fetch_sub(1);
+                });
+        });
+    for ( auto& th : threads )
+        th.join();
+
+    OPTR_CHECK(!b_overlap);
+    OPTR_CHECK(own->value == 8000);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///POOL / SLAB                                                              ------------------------------
+struct alignas(128) OverAligned
+{
+    OverAligned(const int val)
+    :
+        value(val)
+    {};
+
+    int value;
+};
+OPTR_TEST(slab_respects_over_alignment)
+{
+    auto owners = optr::make_owning_owners_o<OverAligned>(3, 5);
+    OPTR_CHECK(owners.size() == 3);
+    for ( auto& own : owners )
+    {
+        OPTR_CHECK(reinterpret_cast<uintptr_t>(own.get()) % alignof(OverAligned) == 0);
+        OPTR_CHECK(own->value == 5);
+        OPTR_CHECK(own.alive());
+    }
+
+    std::vector<optr::owning_ptr_o<Tracked>> keep;
+    {
+        auto tracked = optr::make_owning_owners_o<Tracked>(4, 2);
+        keep.push_back(tracked[1]);
+        OPTR_CHECK(n_live == 4);
+    }
+    OPTR_CHECK(n_live == 1);    //slab kept by remaining member
+    OPTR_CHECK(!keep[0].alive());
+    keep.clear();
+    OPTR_CHECK(n_live == 0);
+}
+
+OPTR_TEST(pool_recycles_blocks)
+{
+    optr::owning_pool_reserve<Tracked>(2);
+    const auto before = optr::get_owning_pool_stats<Tracked>();
+    for ( int i = 0; i < 10; i++ )
+    {
+        auto own = optr::make_pooled_owning_owner_o<Tracked>(i);
+        OPTR_CHECK(own->value == i);
+    }
+    const auto after = optr::get_owning_pool_stats<Tracked>();
+    OPTR_CHECK(after.hits - before.hits == 10);
+    OPTR_CHECK(n_live == 0);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///CONCURRENCY                                                              ------------------------------
+OPTR_TEST(concurrent_last_release_destroys_once)
+{
+    for ( int round = 0; round < 200; round++ )
+    {
+        auto own = optr::make_owning_owner_o<Tracked>(round);
+        std::vector<optr::owning_ptr_o<Tracked>> shares(4, own);
+        own = nullptr;
+
+        std::atomic<int> go{0};
+        std::vector<std::thread> threads;
+        for ( int t = 0; t < 4; t++ )
+            threads.emplace_back([&, t]()
+            {
+                go++;
+                while ( go.load() < 4 )
+                    std::this_thread::yield();
+                shares[t] = nullptr;
+            });
+        for ( auto& th : threads )
+            th.join();
+        OPTR_CHECK(n_live == 0);
+    }
+}
+
+OPTR_TEST(lock_guards_move_through_containers)
+{
+    std::vector<optr::owning_owner_o<Tracked>> owners;
+    for ( int i = 0; i < 4; i++ )
+        owners.push_back(optr::make_owning_owner_o<Tracked>(i));
+
+    using LOCK_ = decltype(owners[0].get_lock());
+    std::vector<LOCK_> guards;
+    for ( auto& own : owners )
+        guards.push_back(own.get_lock());   //vector growth relocates held guards
+    for ( size_t i = 0; i < guards.size(); i++ )
+    {
+        OPTR_CHECK(guards[i].owns_lock());
+        OPTR_CHECK(guards[i].alive());
+        OPTR_CHECK(guards[i]->value == int(i));
+    }
+
+    guards[0].unlock();
+    OPTR_CHECK(!guards[0].owns_lock());
+    OPTR_CHECK(!bool(guards[0]));
+
+    auto mtx = guards[1].release();
+    OPTR_CHECK(mtx != nullptr);
+    OPTR_CHECK(!guards[1].owns_lock());
+    OPTR_CHECK(!guards[1].alive());         //released : holds nothing
+    OPTR_CHECK(guards[1].release() == nullptr);
+    mtx->unlock();                          //caller unlocks released mutex
+
+    std::optional<LOCK_> later(std::move(guards[2]));
+    OPTR_CHECK(later->owns_lock());
+    OPTR_CHECK(!guards[2].owns_lock());
+    OPTR_CHECK(!guards[2].alive());         //moved from
+
+    guards.clear();                         //unlocks guards[3], skips the emptied ones
+    OPTR_CHECK(later->owns_lock());
+    later.reset();
+
+    for ( auto& own : owners )
+    {
+        auto lck = own.get_lock();          //every mutex free again ( one at a time : no lock order )
+        OPTR_CHECK(lck.owns_lock());
+    }
+}
+
+OPTR_TEST(upgrade_and_downgrade_hand_over_without_gap)
+{
+    auto own = optr::make_owning_owner_o<Ledger>();
+
+    auto ulck = own.get_upgrade_lock();
+    {
+        auto slck = own.get_shared_lock();      //readers coexist with the upgrader
+        OPTR_CHECK(slck->debit == ulck->credit);
+        OPTR_CHECK(slck.alive());
+    }
+
+    auto xlck = ulck.upgrade();
+    OPTR_CHECK(xlck.owns_lock());
+    OPTR_CHECK(!ulck.alive());                  //upgraded : holds nothing
+    xlck->debit++;
+    xlck->credit++;
+
+    auto slck = xlck.downgrade();
+    OPTR_CHECK(!xlck.owns_lock());
+    OPTR_CHECK(slck->debit == 1 && slck->credit == 1);
+}
+
+OPTR_TEST(shared_upgrade_exclusive_mix)
+{
+    constexpr int N_THREADS = 4;
+    constexpr int N_OPS     = 5000;
+
+    auto own = optr::make_owning_owner_o<Ledger>();
+    optr::owning_ptr_o<Ledger> shared = own;
+
+    std::atomic<long> n_writes{0};
+    std::atomic<long> n_torn{0};
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < N_THREADS; t++ )
+        threads.emplace_back([&, t]()
+        {
+            std::mt19937 rng(unsigned(t * 104729 + 1));
+
+            for ( int i = 0; i < N_OPS; i++ )
+            {
+                switch ( rng() % 4 )
+                {
+                    case 0:     //reader
+                    {
+                        auto slck = shared.get_shared_lock();
+                        if ( slck->debit != slck->credit )
+                            n_torn++;
+                    } break;
+                    case 1:     //check then modify through upgrade
+                    {
+                        auto ulck = shared.get_upgrade_lock();
+                        const long seen = ulck->debit;
+                        auto xlck = ulck.upgrade();
+                        if ( xlck->debit != seen )
+                            n_torn++;   //a writer got in between
+                        xlck->debit++;
+                        xlck->credit++;
+                        n_writes++;
+                    } break;
+                    case 2:     //writer
+                    {
+                        auto xlck = shared.get_lock();
+                        xlck->debit++;
+                        xlck->credit++;
+                        n_writes++;
+                    } break;
+                    case 3:     //write then keep reading
+                    {
+                        auto xlck = shared.get_lock();
+                        xlck->debit++;
+                        xlck->credit++;
+                        n_writes++;
+                        auto slck = xlck.downgrade();
+                        if ( slck->debit != slck->credit )
+                            n_torn++;
+                    } break;
+                }
+            }
+        });
+    for ( auto& th : threads )
+        th.join();
+
+    OPTR_CHECK(n_torn == 0);
+    auto slck = shared.get_shared_lock();
+    OPTR_CHECK(slck->debit == n_writes && slck->credit == n_writes);
+}
+
+OPTR_TEST(fuzz_copy_assign_destroy_lock)
+{
+    constexpr int N_THREADS = 4;
+    constexpr int N_OPS     = 20000;
+
+    for ( int round = 0; round < 10; round++ )
+    {
+        std::vector<optr::owning_owner_o<Tracked>> owners;
+        for ( int i = 0; i < 3; i++ )
+            owners.push_back(optr::make_owning_owner_o<Tracked>(i));
+
+        std::vector<optr::owning_ptr_o<Tracked>> seeds;
+        for ( auto& own : owners )
+            seeds.push_back(own);
+
+        std::atomic<long> n_locked{0};
+        std::vector<std::thread> threads;
+        for ( int t = 0; t < N_THREADS; t++ )
+            threads.emplace_back([&, t, mine = seeds]() mutable  //copied before owners are cleared
+            {
+                std::mt19937 rng(unsigned(round * 7919 + t));
+
+                for ( int i = 0; i < N_OPS; i++ )
+                {
+                    auto& slot = mine[rng() % mine.size()];
+                    auto& other = mine[rng() % mine.size()];
+                    switch ( rng() % 6 )
+                    {
+                        case 0: slot = other;  break;
+                        case 1: slot = nullptr; break;
+                        case 2: { optr::owning_ptr_o<Tracked> tmp(other); slot = tmp; } break;
+                        case 3: if ( slot != nullptr ) { auto lck = slot.get_lock(); lck->value++; n_locked++; } break;
+                        case 4: (void)slot.alive(); (void)slot.use_count(); break;
+                        case 5: { optr::owning_ptr_o<Tracked> tmp(slot); } break;
+                    }
+                }
+            });
+
+        //owners die while sharers are still churning
+        std::this_thread::yield();
+        owners.clear();
+        seeds.clear();
+
+        for ( auto& th : threads )
+            th.join();
+        OPTR_CHECK(n_live == 0);
+    }
+}
+
+int main(){
+    return optr_test::run_all();
+}
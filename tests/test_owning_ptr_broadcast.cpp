@@ -0,0 +1,149 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <str_owning_ptr_broadcast.hpp>
+
+#include "optr_test.hpp"
+
+///-------------------------------------------------------------------------------------------------------
+/// owning_broadcast_list : updates, dead-entry pruning and reclamation of retired versions.
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    ///Subscriber state
+    struct Listener
+    {
+        Listener(const int val)
+        :
+            value(val)
+        {};
+
+        int value;
+    };
+};
+
+///-------------------------------------------------------------------------------------------------------
+///UPDATES                                                                  ------------------------------
+OPTR_TEST(broadcast_add_remove_and_prune)
+{
+    optr::owning_broadcast_list<Listener> subs;
+    auto a = optr::make_owning_owner_o<Listener>(1);
+    auto b = optr::make_owning_owner_o<Listener>(2);
+    subs.add(a);
+    subs.add(b);
+    subs.add(optr::owning_ptr_o<Listener>());   //not made : ignored
+    OPTR_CHECK(subs.size() == 2);
+
+    int sum = 0;
+    subs.for_each([&sum](const optr::owning_ptr_o<Listener>& lst){ sum += lst->value; });
+    OPTR_CHECK(sum == 3);
+
+    subs.remove(a);
+    OPTR_CHECK(subs.size() == 1);
+
+    b = nullptr;        //owner gone
+    subs.prune();
+    OPTR_CHECK(subs.size() == 0);
+    OPTR_CHECK(subs.retired_count() == 0);    //no reader : freed on write
+}
+
+///-------------------------------------------------------------------------------------------------------
+///RECLAMATION                                                              ------------------------------
+OPTR_TEST(broadcast_retired_bounded_under_overlapping_reads)
+{
+    //some read_guard is open at every write, but each one closes after the next write
+    optr::owning_broadcast_list<Listener> subs;
+    auto own = optr::make_owning_owner_o<Listener>(7);
+
+    size_t n_max_retired = 0;
+    using GUARD_ = optr::owning_broadcast_list<Listener>::read_guard;
+    auto held = std::make_unique<GUARD_>(subs.read());
+    for ( int i = 0; i < 1000; i++ )
+    {
+        if ( i % 2 == 0 )
+            subs.add(own);
+        else
+            subs.remove(own);
+
+        auto next = std::make_unique<GUARD_>(subs.read());
+        held = std::move(next);     //previous guard closes after next one opened
+
+        const size_t n_retired = subs.retired_count();
+        if ( n_retired > n_max_retired )
+            n_max_retired = n_retired;
+    }
+    OPTR_CHECK(n_max_retired <= 3);
+
+    held.reset();
+    subs.synchronize();
+    OPTR_CHECK(subs.retired_count() == 0);
+}
+
+OPTR_TEST(broadcast_guard_keeps_version)
+{
+    optr::owning_broadcast_list<Listener> subs;
+    auto own = optr::make_owning_owner_o<Listener>(9);
+    subs.add(own);
+
+    auto rd = subs.read();
+    for ( int i = 0; i < 10; i++ )
+        subs.clear();
+
+    OPTR_CHECK(rd.size() == 1);
+    OPTR_CHECK(rd[0]->value == 9);     //version retired but still readable
+    OPTR_CHECK(subs.size() == 0);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///CONCURRENCY                                                              ------------------------------
+OPTR_TEST(broadcast_concurrent_readers_and_writer)
+{
+    constexpr int N_READERS = 4;
+    constexpr int N_WRITES  = 2000;
+
+    optr::owning_broadcast_list<Listener> subs;
+    std::vector<optr::owning_owner_o<Listener>> owners;
+    for ( int i = 0; i < 8; i++ )
+        owners.push_back(optr::make_owning_owner_o<Listener>(i));
+
+    std::atomic<bool> b_done{false};
+    std::atomic<int> n_bad{0};
+    std::vector<std::thread> readers;
+    for ( int t = 0; t < N_READERS; t++ )
+    {
+        readers.emplace_back([&]()
+        {
+            while ( !b_done.load(std::memory_order_acquire) )
+            {
+                subs.for_each([&](const optr::owning_ptr_o<Listener>& lst)
+                {
+                    if ( lst->value < 0 || lst->value >= 8 )
+                        n_bad++;
+                });
+            }
+        });
+    }
+
+    for ( int i = 0; i < N_WRITES; i++ )
+    {
+        auto& own = owners[i % owners.size()];
+        if ( ( i / owners.size() ) % 2 == 0 )
+            subs.add(own);
+        else
+            subs.remove(own);
+    }
+    b_done.store(true, std::memory_order_release);
+    for ( auto& thr : readers )
+        thr.join();
+
+    OPTR_CHECK(n_bad == 0);
+    subs.synchronize();
+    OPTR_CHECK(subs.retired_count() == 0);
+}
+
+int main(){
+    return optr_test::run_all();
+}
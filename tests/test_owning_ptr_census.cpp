@@ -0,0 +1,122 @@
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <str_owning_ptr.hpp>
+
+#include "optr_test.hpp"
+
+///-------------------------------------------------------------------------------------------------------
+/// optr::census() ( built with OPTR_ENABLE_CENSUS ), including reads racing register construction and
+/// destruction on other threads.
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    ///Held type recognisable in census entries
+    struct Tagged
+    {
+        Tagged(const int val)
+        :
+            value(val)
+        {};
+
+        int value;
+    };
+
+    ///Census entries holding Tagged
+    size_t
+        count_tagged(const std::vector<optr::owning_census_entry>& entries,
+                     size_t* n_zombies = nullptr)
+    {
+        size_t n_tagged = 0;
+        for ( const auto& ent : entries )
+        {
+            if ( ent.type_name == nullptr || std::strcmp(ent.type_name, typeid(Tagged).name()) != 0 )
+                continue;
+            n_tagged++;
+            if ( n_zombies != nullptr && ent.zombie() )
+                (*n_zombies)++;
+        }
+        return n_tagged;
+    };
+};
+
+///-------------------------------------------------------------------------------------------------------
+///ENTRIES                                                                  ------------------------------
+OPTR_TEST(census_lists_live_registers)
+{
+    OPTR_CHECK(optr::census_enabled);
+    OPTR_CHECK(count_tagged(optr::census()) == 0);
+
+    auto own = optr::make_owning_owner_o<Tagged>(1);
+    optr::owning_ptr_o<Tagged> shr;
+    {
+        auto gone = optr::make_owning_owner_o<Tagged>(2);
+        shr = gone;
+    }
+
+    size_t n_zombies = 0;
+    OPTR_CHECK(count_tagged(optr::census(), &n_zombies) == 2);
+    OPTR_CHECK(n_zombies == 1);
+
+    shr = nullptr;
+    OPTR_CHECK(count_tagged(optr::census()) == 1);
+}
+
+OPTR_TEST(census_covers_pool_and_slab_blocks)
+{
+    {
+        auto pooled = optr::make_pooled_owning_owner_o<Tagged>(3);
+        auto slab   = optr::make_owning_owners_o<Tagged>(4, 5);
+        OPTR_CHECK(count_tagged(optr::census()) == 5);
+    }
+    OPTR_CHECK(count_tagged(optr::census()) == 0);  //cached pool block is not live
+}
+
+///-------------------------------------------------------------------------------------------------------
+///CONCURRENCY                                                              ------------------------------
+OPTR_TEST(census_races_construction_and_destruction)
+{
+    constexpr int N_THREADS = 4;
+    constexpr int N_ROUNDS  = 2000;
+
+    std::atomic<bool> b_done{false};
+    std::thread reader([&]()
+    {
+        while ( !b_done.load(std::memory_order_acquire) )
+        {
+            for ( const auto& ent : optr::census() )
+                (void)ent.zombie();
+        }
+    });
+
+    std::vector<std::thread> workers;
+    for ( int t = 0; t < N_THREADS; t++ )
+    {
+        workers.emplace_back([t]()
+        {
+            for ( int i = 0; i < N_ROUNDS; i++ )
+            {
+                auto own = ( i % 2 == 0 ) ? optr::make_owning_owner_o<Tagged>(t)
+                                          : optr::make_pooled_owning_owner_o<Tagged>(t);
+                optr::owning_ptr_o<Tagged> shr = own;
+                own = nullptr;      //owner dies while shared
+                Tagged obj(i);
+                auto val = optr::make_owning_owner_v<Tagged>(&obj);     //_v does not own obj
+                (void)val;
+            }
+        });
+    }
+    for ( auto& thr : workers )
+        thr.join();
+    b_done.store(true, std::memory_order_release);
+    reader.join();
+
+    OPTR_CHECK(count_tagged(optr::census()) == 0);
+}
+
+int main(){
+    return optr_test::run_all();
+}
@@ -0,0 +1,149 @@
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <str_owning_ptr.hpp>
+
+#include "optr_test.hpp"
+
+///-------------------------------------------------------------------------------------------------------
+/// Latency histograms ( built with OPTR_ENABLE_LATENCY_HISTOGRAM ) : bucket math, lock_wait / destroy
+/// samples and CSV export.
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    ///Held type for lock and destroy samples
+    struct Sampled
+    {
+        int value = 0;
+    };
+
+    ///Whether ns falls in its bucket and the bucket maps back to itself
+    bool
+        round_trips(const uint64_t ns)
+    {
+        using namespace optr::optr_implem;
+
+        const size_t b = latency_bucket_of(ns);
+        return b < LAT_BUCKETS_
+               && latency_bucket_lower(b) <= ns
+               && ns <= latency_bucket_upper(b)
+               && latency_bucket_of(latency_bucket_lower(b)) == b
+               && latency_bucket_of(latency_bucket_upper(b)) == b;
+    };
+};
+
+///-------------------------------------------------------------------------------------------------------
+///BUCKETS                                                                  ------------------------------
+OPTR_TEST(latency_buckets_round_trip)
+{
+    using namespace optr::optr_implem;
+
+    OPTR_CHECK(optr::latency_histogram_enabled);
+
+    for ( uint64_t ns = 0; ns < 5000; ns++ )
+        OPTR_CHECK(round_trips(ns));
+    for ( size_t exp = 1; exp <= LAT_MAX_EXP_; exp++ )
+    {
+        const uint64_t pow2 = uint64_t(1) << exp;
+        OPTR_CHECK(round_trips(pow2 - 1));
+        OPTR_CHECK(round_trips(pow2));
+        OPTR_CHECK(round_trips(pow2 + 1));
+    }
+
+    //buckets tile 0 .. LAT_MAX_NS_ without gaps or overlap
+    OPTR_CHECK(latency_bucket_lower(0) == 0);
+    for ( size_t b = 0; b + 1 < LAT_BUCKETS_; b++ )
+        OPTR_CHECK(latency_bucket_lower(b + 1) == latency_bucket_upper(b) + 1);
+    OPTR_CHECK(latency_bucket_upper(LAT_BUCKETS_ - 1) == LAT_MAX_NS_);
+
+    //out of range values clamp into the last bucket
+    OPTR_CHECK(latency_bucket_of(LAT_MAX_NS_) == LAT_BUCKETS_ - 1);
+    OPTR_CHECK(latency_bucket_of(~uint64_t(0)) == LAT_BUCKETS_ - 1);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///SAMPLES                                                                  ------------------------------
+OPTR_TEST(latency_contended_lock_records_wait)
+{
+    optr::latency_reset();
+
+    auto own = optr::make_owning_owner_o<Sampled>();
+    optr::owning_ptr_o<Sampled> shared = own;
+    {
+        auto lck = own.get_lock();
+        std::thread waiter([&shared]()
+        {
+            auto wlck = shared.get_lock();  //blocks until main thread unlocks
+            wlck->value++;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        lck.unlock();
+        waiter.join();
+    }
+
+    const auto hist = optr::latency_histogram(optr::owning_latency_metric::lock_wait);
+    OPTR_CHECK(hist.total == 2);                //main ( uncontended ) + waiter
+    OPTR_CHECK(hist.counts[0] >= 1);            //uncontended lock records 0
+    OPTR_CHECK(hist.max() >= 1000000);          //waiter blocked for milliseconds
+
+    shared = nullptr;
+    own = nullptr;
+    OPTR_CHECK(optr::latency_histogram(optr::owning_latency_metric::destroy).total == 1);
+
+    optr::latency_reset();
+    OPTR_CHECK(optr::latency_histogram(optr::owning_latency_metric::lock_wait).total == 0);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///EXPORT                                                                   ------------------------------
+OPTR_TEST(latency_dump_csv_rows)
+{
+    optr::latency_reset();
+    {
+        auto own = optr::make_owning_owner_o<Sampled>();
+        for ( int i = 0; i < 10; i++ )
+            own.get_lock()->value++;
+    }
+
+    std::ostringstream os;
+    optr::latency_dump_csv(os);
+    std::istringstream is(os.str());
+
+    std::string line;
+    OPTR_CHECK(std::getline(is, line) && line == "metric,lower_ns,upper_ns,count");
+
+    uint64_t n_lock_wait = 0;
+    uint64_t n_destroy   = 0;
+    while ( std::getline(is, line) )
+    {
+        std::istringstream row(line);
+        std::string metric, lower, upper, count;
+        OPTR_CHECK(std::getline(row, metric, ',') && std::getline(row, lower, ',')
+                   && std::getline(row, upper, ',') && std::getline(row, count));
+
+        const uint64_t lo  = std::stoull(lower);
+        const uint64_t hi  = std::stoull(upper);
+        const uint64_t cnt = std::stoull(count);
+        const size_t b = optr::optr_implem::latency_bucket_of(lo);
+        OPTR_CHECK(lo <= hi && cnt > 0);
+        OPTR_CHECK(optr::owning_latency_histogram::bucket_lower(b) == lo
+                   && optr::owning_latency_histogram::bucket_upper(b) == hi);
+
+        if ( metric == "lock_wait" )
+            n_lock_wait += cnt;
+        else if ( metric == "destroy" )
+            n_destroy += cnt;
+        else
+            OPTR_CHECK(!"unknown metric");
+    }
+    OPTR_CHECK(n_lock_wait == 10);
+    OPTR_CHECK(n_destroy == 1);
+}
+
+int main(){
+    return optr_test::run_all();
+}
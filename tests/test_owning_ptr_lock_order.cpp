@@ -0,0 +1,124 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <str_owning_ptr.hpp>
+
+#include "optr_test.hpp"
+
+///-------------------------------------------------------------------------------------------------------
+/// Lock-order checking ( built with OPTR_LOCK_ORDER_CHECK ) : an A -> B / B -> A inversion between two
+/// lock classes is reported exactly once.
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    struct Account
+    {
+        int balance = 0;
+    };
+    struct Inventory
+    {
+        int items = 0;
+    };
+};
+
+template <>
+struct optr::owning_traits<Account>
+:
+    public optr::owning_traits_default
+{
+    static constexpr const char* lock_class = "account";
+};
+template <>
+struct optr::owning_traits<Inventory>
+:
+    public optr::owning_traits_default
+{
+    static constexpr const char* lock_class = "inventory";
+};
+
+///-------------------------------------------------------------------------------------------------------
+///INVERSION                                                                ------------------------------
+OPTR_TEST(lock_order_inversion_reported_once)
+{
+    std::vector<std::vector<std::string>> cycles;
+    optr::set_lock_order_report([&cycles](const std::vector<std::string>& cycle){ cycles.push_back(cycle); });
+
+    auto acct = optr::make_owning_owner_o<Account>();
+    auto inv  = optr::make_owning_owner_o<Inventory>();
+
+    for ( int round = 0; round < 3; round++ )
+    {
+        {
+            auto alck = acct.get_lock();    //account -> inventory
+            auto ilck = inv.get_lock();
+            alck->balance++;
+            ilck->items++;
+        }
+        {
+            auto ilck = inv.get_lock();     //inventory -> account : closes cycle
+            auto alck = acct.get_lock();
+            alck->balance--;
+        }
+    }
+
+    //same order from another thread adds no new edge
+    std::thread([&]()
+    {
+        auto ilck = inv.get_lock();
+        auto alck = acct.get_lock();
+    }).join();
+
+    OPTR_CHECK(cycles.size() == 1);
+    if ( cycles.size() == 1 )
+    {
+        const auto& cycle = cycles[0];
+        OPTR_CHECK(cycle.size() == 3);
+        OPTR_CHECK(cycle.front() == cycle.back());
+        OPTR_CHECK(cycle.front() == "inventory" && cycle[1] == "account");
+    }
+
+    optr::set_lock_order_report(nullptr);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///CONCURRENCY                                                              ------------------------------
+OPTR_TEST(lock_order_report_replaced_while_locking)
+{
+    struct Left  { int v = 0; };
+    struct Right { int v = 0; };
+
+    auto left  = optr::make_owning_owner_o<Left>();
+    auto right = optr::make_owning_owner_o<Right>();
+
+    std::atomic<bool> b_done{false};
+    std::atomic<int> n_reports{0};
+    optr::set_lock_order_report([&n_reports](const std::vector<std::string>&){ n_reports++; });
+    std::thread locker([&]()
+    {
+        {
+            auto llck = left.get_lock();
+            auto rlck = right.get_lock();
+        }
+        {
+            auto rlck = right.get_lock();   //inversion found while the other thread swaps handlers
+            auto llck = left.get_lock();
+        }
+        b_done = true;
+    });
+    do
+    {
+        optr::set_lock_order_report([&n_reports](const std::vector<std::string>&){ n_reports++; });
+    } while ( !b_done );
+    locker.join();
+
+    OPTR_CHECK(n_reports == 1);
+
+    optr::set_lock_order_report(nullptr);
+}
+
+int main(){
+    return optr_test::run_all();
+}
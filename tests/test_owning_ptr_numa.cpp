@@ -0,0 +1,118 @@
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <thread>
+#include <vector>
+
+#include <str_owning_ptr.hpp>
+
+#include "optr_test.hpp"
+
+///-------------------------------------------------------------------------------------------------------
+/// NUMA-aware pool ( built with OPTR_ENABLE_NUMA ) : node lookup follows the running cpu and same-node
+/// releases keep feeding the thread cache.
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    ///Held type for pooled blocks
+    struct Pooled
+    {
+        Pooled(const int val = 0)
+        :
+            value(val)
+        {};
+
+        int value;
+    };
+
+    ///Cpus calling thread may run on
+    std::vector<int>
+        allowed_cpus()
+    {
+        std::vector<int> cpus;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if ( pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0 )
+            return cpus;
+        for ( int c = 0; c < CPU_SETSIZE; c++ )
+            if ( CPU_ISSET(c, &set) )
+                cpus.push_back(c);
+        return cpus;
+    };
+
+    ///Restrict calling thread to cpus
+    bool
+        pin_to(const std::vector<int>& cpus)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for ( const int c : cpus )
+            CPU_SET(c, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    };
+
+    ///Node reported by the kernel for calling thread
+    unsigned
+        kernel_node()
+    {
+        unsigned cpu = 0, node = 0;
+        if ( syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 )
+            return 0;
+        return node;
+    };
+};
+
+///-------------------------------------------------------------------------------------------------------
+///NODE LOOKUP                                                              ------------------------------
+OPTR_TEST(node_lookup_follows_running_cpu)
+{
+    const auto cpus = allowed_cpus();
+    OPTR_CHECK(!cpus.empty());
+
+    for ( const int c : cpus )      //moving the thread between cpus must not serve a stale node
+    {
+        OPTR_CHECK(pin_to({ c }));
+        OPTR_CHECK(optr::optr_implem::numa_node_of_thread() == kernel_node());
+    }
+    OPTR_CHECK(pin_to(cpus));
+}
+
+///-------------------------------------------------------------------------------------------------------
+///POOL                                                                     ------------------------------
+OPTR_TEST(same_node_release_is_recycled)
+{
+    const auto cpus = allowed_cpus();
+    OPTR_CHECK(!cpus.empty());
+    OPTR_CHECK(pin_to({ cpus.front() }));
+
+    std::vector<optr::owning_owner_o<Pooled>> made;
+    std::thread maker([&]()
+    {
+        OPTR_CHECK(pin_to({ cpus.front() }));   //allocating thread on the releasing thread's node
+        for ( int i = 0; i < 8; i++ )
+            made.push_back(optr::make_pooled_owning_owner_o<Pooled>(i));
+    });
+    maker.join();
+
+    const auto before = optr::get_owning_pool_stats<Pooled>();
+    made.clear();
+    const auto released = optr::get_owning_pool_stats<Pooled>();
+    OPTR_CHECK(released.recycled - before.recycled == 8);
+    OPTR_CHECK(released.freed == before.freed);
+
+    for ( int i = 0; i < 8; i++ )
+    {
+        auto own = optr::make_pooled_owning_owner_o<Pooled>(i);
+        OPTR_CHECK(own->value == i);
+    }
+    const auto after = optr::get_owning_pool_stats<Pooled>();
+    OPTR_CHECK(after.hits - released.hits == 8);
+    OPTR_CHECK(pin_to(cpus));
+}
+
+int main(){
+    return optr_test::run_all();
+}
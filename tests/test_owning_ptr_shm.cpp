@@ -0,0 +1,196 @@
+#include <cstdint>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <str_owning_ptr_shm.hpp>
+
+#include "optr_test.hpp"
+
+///-------------------------------------------------------------------------------------------------------
+/// owning_shm_segment across two processes : the parent owns objects, a forked child maps the segment
+/// by name and attaches to them.
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    ///Trivially copyable entity state
+    struct Entity
+    {
+        uint32_t tag;
+        uint32_t hp;
+    };
+    ///Same size as Entity, never published
+    struct Decoy
+    {
+        uint32_t tag;
+        uint32_t pad;
+    };
+
+    constexpr uint32_t ENTITY_TAG_ = 0xE0E0E0E0;
+    constexpr uint32_t DECOY_TAG_  = 0xD0D0D0D0;
+    constexpr size_t   SEG_BYTES_  = 1 << 16;
+
+    ///Segment name unique to this test run
+    std::string
+        segment_name(){
+        return "/optr_test_" + std::to_string(::getpid());
+    };
+
+    ///Run fn in a forked child, returning its failed check count ( -1 : crashed or threw )
+    template <typename Fn>
+    int
+        in_child(Fn&& fn)
+    {
+        const pid_t pid = ::fork();
+        if ( pid == 0 )
+        {
+            int n_fail = 0;
+            try
+            {
+                optr_test::failures() = 0;
+                fn();
+                n_fail = optr_test::failures();
+            }
+            catch (...)
+            {
+                n_fail = 1;
+            }
+            ::_exit(n_fail == 0 ? 0 : 1);
+        }
+
+        int status = 0;
+        if ( pid < 0 || ::waitpid(pid, &status, 0) != pid || !WIFEXITED(status) )
+            return -1;
+        return WEXITSTATUS(status);
+    };
+};
+
+///-------------------------------------------------------------------------------------------------------
+///OWNER DEATH                                                              ------------------------------
+OPTR_TEST(shm_reader_sees_owner_death)
+{
+    const auto name = segment_name();
+    auto seg = optr::owning_shm_segment::create(name, SEG_BYTES_);
+
+    auto own = optr::make_owning_shm_owner<Entity>(seg, Entity{ ENTITY_TAG_, 100 });
+    seg.publish("hero", own);
+
+    int pipe_fd[2];
+    OPTR_CHECK(::pipe(pipe_fd) == 0);
+
+    const pid_t pid = ::fork();
+    if ( pid == 0 )
+    {
+        ::close(pipe_fd[1]);
+        int n_fail = 0;
+        {
+            auto rseg = optr::owning_shm_segment::open(name);
+            auto hero = rseg.attach<Entity>("hero");
+            n_fail += !( hero.alive() && hero->tag == ENTITY_TAG_ && hero.use_count() == 2 );
+
+            char go = 0;
+            n_fail += ::read(pipe_fd[0], &go, 1) != 1;     //parent dropped its owner
+            n_fail += hero.alive();
+            n_fail += hero->hp != 0;
+            n_fail += !rseg.attach<Entity>("hero").get();   //still shared by this process
+        }
+        ::_exit(n_fail == 0 ? 0 : 1);
+    }
+    ::close(pipe_fd[0]);
+
+    while ( own.use_count() != 2 )  //child attached
+        ::usleep(1000);
+    own->hp = 0;
+    own = optr::owning_shm_owner<Entity>();
+    OPTR_CHECK(::write(pipe_fd[1], "x", 1) == 1);
+    ::close(pipe_fd[1]);
+
+    int status = 0;
+    OPTR_CHECK(::waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    OPTR_CHECK(seg.find("hero") == 0);  //child's release freed block and its name
+
+    optr::owning_shm_segment::unlink(name);
+}
+
+///-------------------------------------------------------------------------------------------------------
+///RELEASED BLOCKS                                                          ------------------------------
+OPTR_TEST(shm_attach_never_revives_released_block)
+{
+    const auto name = segment_name();
+    auto seg = optr::owning_shm_segment::create(name, SEG_BYTES_);
+
+    uint64_t stale = 0;
+    {
+        auto own = optr::make_owning_shm_owner<Entity>(seg, Entity{ ENTITY_TAG_, 1 });
+        seg.publish("gone", own);
+        stale = own.offset();
+    }
+    OPTR_CHECK(seg.find("gone") == 0);
+
+    OPTR_CHECK(in_child([&]()
+    {
+        auto rseg = optr::owning_shm_segment::open(name);
+        OPTR_CHECK(!rseg.attach<Entity>("gone").get());
+        OPTR_CHECK(!rseg.attach<Entity>(stale).get());     //share_count 0 : not revived
+    }) == 0);
+
+    //block reused by another object : old name must not resolve to it
+    auto decoy = optr::make_owning_shm_owner<Decoy>(seg, Decoy{ DECOY_TAG_, 0 });
+    OPTR_CHECK(decoy.offset() == stale);
+    OPTR_CHECK(in_child([&]()
+    {
+        auto rseg = optr::owning_shm_segment::open(name);
+        OPTR_CHECK(!rseg.attach<Entity>("gone").get());
+    }) == 0);
+    OPTR_CHECK(decoy.use_count() == 1);
+
+    optr::owning_shm_segment::unlink(name);
+}
+
+OPTR_TEST(shm_attach_by_name_races_free_and_reuse)
+{
+    constexpr int N_ROUNDS = 2000;
+
+    const auto name = segment_name();
+    auto seg = optr::owning_shm_segment::create(name, SEG_BYTES_);
+
+    const pid_t pid = ::fork();
+    if ( pid == 0 )
+    {
+        //publish, free and reuse the same block as a different type while the parent attaches by name
+        auto wseg = optr::owning_shm_segment::open(name);
+        for ( int i = 0; i < N_ROUNDS; i++ )
+        {
+            {
+                auto own = optr::make_owning_shm_owner<Entity>(wseg, Entity{ ENTITY_TAG_, uint32_t(i) });
+                wseg.publish("churn", own);
+            }
+            auto decoy = optr::make_owning_shm_owner<Decoy>(wseg, Decoy{ DECOY_TAG_, 0 });
+        }
+        ::_exit(0);
+    }
+
+    int n_seen = 0;
+    int n_wrong = 0;
+    int status = 0;
+    while ( ::waitpid(pid, &status, WNOHANG) == 0 )
+    {
+        auto ent = seg.attach<Entity>("churn");
+        if ( ent.get() == nullptr )
+            continue;
+        n_seen++;
+        if ( ent->tag != ENTITY_TAG_ )
+            n_wrong++;
+    }
+    OPTR_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    OPTR_CHECK(n_wrong == 0);
+    (void)n_seen;   //depends on scheduling
+
+    optr::owning_shm_segment::unlink(name);
+}
+
+int main(){
+    return optr_test::run_all();
+}
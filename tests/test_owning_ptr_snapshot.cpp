@@ -0,0 +1,278 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <str_owning_ptr_snapshot.hpp>
+
+#include "optr_test.hpp"
+
+///-------------------------------------------------------------------------------------------------------
+/// owning_snapshot_writer / owning_snapshot_reader round trips and malformed stream rejection.
+///-------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    ///Graph node linking to other nodes
+    struct Node
+    {
+        int value = 0;
+        optr::owning_ptr_o<Node> left;
+        optr::owning_ptr_o<Node> right;
+    };
+
+    void
+        optr_save(optr::owning_snapshot_writer& wrtr,
+                  const Node& node)
+    {
+        wrtr.put(node.value);
+        wrtr.link(node.left);
+        wrtr.link(node.right);
+    };
+    void
+        optr_load(optr::owning_snapshot_reader& rdr,
+                  Node& node)
+    {
+        node.value = rdr.get<int>();
+        node.left  = rdr.link<Node>();
+        node.right = rdr.link<Node>();
+    };
+
+    ///Base / derived pair linked from one register
+    struct Shape
+    {
+        virtual ~Shape() = default;     //last release may run through either type
+        int sides = 0;
+    };
+    struct Square : Shape
+    {
+        int length = 0;
+    };
+    ///Holds the same register through both types
+    struct Canvas
+    {
+        optr::owning_ptr_o<Shape>  shape;
+        optr::owning_ptr_o<Square> square;
+    };
+
+    void
+        optr_save(optr::owning_snapshot_writer& wrtr,
+                  const Shape& shape){
+        wrtr.put(shape.sides);
+    };
+    void
+        optr_save(optr::owning_snapshot_writer& wrtr,
+                  const Square& square)
+    {
+        wrtr.put(square.sides);
+        wrtr.put(square.length);
+    };
+    void
+        optr_save(optr::owning_snapshot_writer& wrtr,
+                  const Canvas& canvas)
+    {
+        wrtr.link(canvas.shape);
+        wrtr.link(canvas.square);
+    };
+
+    ///Header field offsets in stream
+    constexpr size_t ARENA_ALIGN_AT = offsetof(optr::optr_implem::owning_snapshot_header, arena_align);
+
+    ///Stream position of a field of record idx
+    constexpr size_t
+        record_field_at(size_t idx,
+                        size_t field_offset){
+        return sizeof(optr::optr_implem::owning_snapshot_header)
+               + idx * sizeof(optr::optr_implem::owning_snapshot_record)
+               + field_offset;
+    };
+
+    ///Whether parsing and loading record 0 of stream is rejected
+    bool
+        rejected(const std::vector<unsigned char>& stream)
+    {
+        try
+        {
+            optr::owning_snapshot_reader rdr(stream);
+            auto root = rdr.load<Node>(0);
+            root->left = nullptr;   //break any cycle a corrupted table created
+            root->right = nullptr;
+        }
+        catch ( const std::runtime_error& )
+        {
+            return true;
+        }
+        return false;
+    };
+};
+
+///-------------------------------------------------------------------------------------------------------
+///ROUND TRIP                                                               ------------------------------
+OPTR_TEST(snapshot_round_trip_keeps_sharing)
+{
+    std::vector<unsigned char> stream;
+    {
+        auto root   = optr::make_owning_owner_o<Node>();
+        auto shared = optr::make_owning_owner_o<Node>();
+        root->value   = 1;
+        shared->value = 2;
+        root->left  = shared;
+        root->right = shared;
+        shared->left = root;    //cycle
+
+        optr::owning_snapshot_writer wrtr;
+        OPTR_CHECK(wrtr.write<Node>(root) == 0);
+        OPTR_CHECK(wrtr.size() == 2);
+        stream = wrtr.finish();
+
+        shared->left = nullptr;
+    }
+
+    optr::owning_snapshot_reader rdr(stream);
+    auto root = rdr.load_owner<Node>(0);
+    OPTR_CHECK(root->value == 1);
+    OPTR_CHECK(root->left == root->right);
+    OPTR_CHECK(root->left->value == 2);
+    OPTR_CHECK(root->left->left == root);
+    OPTR_CHECK(root.alive());
+
+    root->left->left = nullptr;     //break cycle
+}
+
+OPTR_TEST(snapshot_rejects_mixed_type_links)
+{
+    auto canvas = optr::make_owning_owner_o<Canvas>();
+    auto square = optr::make_owning_owner_o<Square>();
+    canvas->square = square;
+    canvas->shape  = optr::owning_ptr_o<Shape>(canvas->square);
+
+    optr::owning_snapshot_writer wrtr;
+    bool b_threw = false;
+    try
+    {
+        wrtr.write<Canvas>(canvas);
+    }
+    catch ( const std::logic_error& )
+    {
+        b_threw = true;
+    }
+    OPTR_CHECK(b_threw);
+}
+
+OPTR_TEST(snapshot_alive_owners_are_opt_in)
+{
+    std::vector<unsigned char> stream;
+    {
+        auto root  = optr::make_owning_owner_o<Node>();
+        auto live  = optr::make_owning_owner_o<Node>();
+        auto dead  = optr::make_owning_owner_o<Node>();
+        root->left  = live;
+        root->right = dead;
+        live->value = 7;
+        dead = nullptr;     //root->right is only sharer left
+
+        optr::owning_snapshot_writer wrtr;
+        wrtr.write<Node>(root);
+        stream = wrtr.finish();
+    }
+
+    optr::owning_snapshot_reader rdr(stream);
+    OPTR_CHECK(rdr.was_alive(0) && rdr.was_alive(1) && !rdr.was_alive(2));
+
+    auto root = rdr.load<Node>(0);
+    OPTR_CHECK(!root.alive());
+    OPTR_CHECK(!root->left.alive());
+
+    auto owners = rdr.load_alive_owners<Node>();
+    OPTR_CHECK(owners.size() == 2);
+    OPTR_CHECK(root.alive());
+    OPTR_CHECK(root->left.alive());
+    OPTR_CHECK(root->left->value == 7);
+    OPTR_CHECK(!root->right.alive());
+    OPTR_CHECK(rdr.load_alive_owners<Node>().empty());  //already claimed
+
+    owners.clear();
+    OPTR_CHECK(!root.alive());
+}
+
+///-------------------------------------------------------------------------------------------------------
+///MALFORMED STREAMS                                                        ------------------------------
+OPTR_TEST(snapshot_rejects_bad_arena_alignment)
+{
+    auto root = optr::make_owning_owner_o<Node>();
+    optr::owning_snapshot_writer wrtr;
+    wrtr.write<Node>(root);
+    const auto good = wrtr.finish();
+
+    for ( uint64_t align : { uint64_t(0), uint64_t(3), uint64_t(96), uint64_t(1) << 40 } )
+    {
+        auto bad = good;
+        std::memcpy(bad.data() + ARENA_ALIGN_AT, &align, sizeof(align));
+
+        bool b_threw = false;
+        try
+        {
+            optr::owning_snapshot_reader rdr(bad);
+        }
+        catch ( const std::runtime_error& )
+        {
+            b_threw = true;
+        }
+        OPTR_CHECK(b_threw);
+    }
+}
+
+OPTR_TEST(snapshot_rejects_truncated_stream)
+{
+    auto root = optr::make_owning_owner_o<Node>();
+    optr::owning_snapshot_writer wrtr;
+    wrtr.write<Node>(root);
+    auto stream = wrtr.finish();
+    stream.resize(stream.size() - 1);
+
+    bool b_threw = false;
+    try
+    {
+        optr::owning_snapshot_reader rdr(stream);
+    }
+    catch ( const std::runtime_error& )
+    {
+        b_threw = true;
+    }
+    OPTR_CHECK(b_threw);
+}
+
+OPTR_TEST(snapshot_rejects_corrupted_record_table)
+{
+    using REC_ = optr::optr_implem::owning_snapshot_record;
+
+    auto root = optr::make_owning_owner_o<Node>();
+    root->left = optr::make_owning_owner_o<Node>();
+    optr::owning_snapshot_writer wrtr;
+    wrtr.write<Node>(root);
+    const auto good = wrtr.finish();
+    OPTR_CHECK(!rejected(good));
+
+    auto patched = [&good](size_t at,
+                           uint64_t val)
+    {
+        auto bad = good;
+        std::memcpy(bad.data() + at, &val, sizeof(val));
+        return bad;
+    };
+
+    //offsets that wrap a naive offset + size check
+    OPTR_CHECK(rejected(patched(record_field_at(0, offsetof(REC_, payload_offset)), ~uint64_t(0) - 1)));
+    OPTR_CHECK(rejected(patched(record_field_at(0, offsetof(REC_, payload_size)), ~uint64_t(0))));
+    OPTR_CHECK(rejected(patched(record_field_at(0, offsetof(REC_, arena_offset)), ~uint64_t(0) - 63)));
+
+    //two records placed on the same arena bytes
+    uint64_t first_offset = 0;
+    std::memcpy(&first_offset, good.data() + record_field_at(0, offsetof(REC_, arena_offset)), sizeof(first_offset));
+    OPTR_CHECK(rejected(patched(record_field_at(1, offsetof(REC_, arena_offset)), first_offset)));
+}
+
+int main(){
+    return optr_test::run_all();
+}